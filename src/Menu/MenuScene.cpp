@@ -13,6 +13,8 @@
 #include "examples/CameraDemo/CameraDemoScene.h"
 #include "examples/DualPaletteTest/DualPaletteTestScene.h"
 #include "examples/FontTest/FontTestScene.h"
+#include "examples/RenderBenchmark/RenderBenchmarkScene.h"
+#include "examples/AudioLab/AudioLabScene.h"
 #include "examples/SpritesDemo/SpritesDemoScene.h"
 #include "examples/TileMapDemo/TileMapDemoScene.h"
 #include "examples/UIElementDemo/CheckBoxDemo/CheckBoxScene.h"
@@ -38,6 +40,8 @@ metroidvania::MetroidvaniaScene metroidvaniaScene;
 camerademo::CameraDemoScene cameraDemoScene;
 dualpalettetest::DualPaletteTestScene dualPaletteTestScene;
 fonttest::FontTestScene fontTestScene;
+renderbenchmark::RenderBenchmarkScene renderBenchmarkScene;
+audiolab::AudioLabScene audioLabScene;
 checkboxdemo::CheckBoxScene checkBoxScene;
 buttondemo::ButtonScene buttonScene;
 labeldemo::LabelScene labelScene;
@@ -190,6 +194,14 @@ void MenuScene::setupMainMenu() {
         engine.setScene(&dualPaletteTestScene);
     }, pr32::graphics::ui::TextAlignment::CENTER, menu::BTN_FONT_SIZE);
     
+    renderBenchmarkButton = new pr32::graphics::ui::UIButton("RENDER BENCHMARK", menu::BTN_SELECT, 0, 0, btnW, btnH, []() {
+        engine.setScene(&renderBenchmarkScene);
+    }, pr32::graphics::ui::TextAlignment::CENTER, menu::BTN_FONT_SIZE);
+    
+    audioLabButton = new pr32::graphics::ui::UIButton("AUDIO LAB", menu::BTN_SELECT, 0, 0, btnW, btnH, []() {
+        engine.setScene(&audioLabScene);
+    }, pr32::graphics::ui::TextAlignment::CENTER, menu::BTN_FONT_SIZE);
+    
     uiElementsButton = new pr32::graphics::ui::UIButton("UIELEMENTS", menu::BTN_SELECT, 0, 0, btnW, btnH, [this]() {
         showMenu(MenuState::UIELEMENTS);
     }, pr32::graphics::ui::TextAlignment::CENTER, menu::BTN_FONT_SIZE);
@@ -289,6 +301,8 @@ void MenuScene::showMenu(MenuState state) {
 #endif
             buttonLayout->addElement(fontTestButton);
             buttonLayout->addElement(dualPaletteTestButton);
+            buttonLayout->addElement(renderBenchmarkButton);
+            buttonLayout->addElement(audioLabButton);
             buttonLayout->addElement(uiElementsButton);
             break;
             
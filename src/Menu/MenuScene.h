@@ -34,6 +34,8 @@ private:
     pixelroot32::graphics::ui::UIButton* tileMapDemoButton;
     pixelroot32::graphics::ui::UIButton* fontTestButton;
     pixelroot32::graphics::ui::UIButton* dualPaletteTestButton;
+    pixelroot32::graphics::ui::UIButton* renderBenchmarkButton;
+    pixelroot32::graphics::ui::UIButton* audioLabButton;
     pixelroot32::graphics::ui::UIButton* uiElementsButton;
     
     // Games menu buttons
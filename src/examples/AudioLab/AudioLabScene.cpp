@@ -0,0 +1,1146 @@
+#include "AudioLabScene.h"
+#include "core/Engine.h"
+#include "Menu/MenuScene.h"
+#include "graphics/Color.h"
+#include "examples/Common/BenchTimer.h"
+#include "examples/Common/Sequencer.h"
+#include "examples/Common/SfxCache.h"
+#include "examples/Games/BrickBreaker/GameConstants.h"
+#include "examples/Games/SpaceInvaders/GameConstants.h"
+#include "examples/Games/TicTacToe/GameConstants.h"
+#include <cstdio>
+
+namespace pr32 = pixelroot32;
+using Color = pr32::graphics::Color;
+using pr32::audio::AudioEvent;
+using pr32::audio::MusicNote;
+using pr32::audio::MusicTrack;
+using pr32::audio::Note;
+using pr32::audio::WaveType;
+
+extern pr32::core::Engine engine;
+extern MenuScene menuScene;
+
+namespace audiolab {
+
+using common::nowMicros;
+
+namespace {
+
+constexpr uint8_t BTN_UP = 0;
+constexpr uint8_t BTN_LEFT = 2;
+constexpr uint8_t BTN_RIGHT = 3;
+constexpr uint8_t BTN_A = 4;
+constexpr uint8_t BTN_B = 5;
+
+// Same rates as the backends in main.cpp / main_native.cpp.
+#ifdef PLATFORM_NATIVE
+constexpr int LAB_SAMPLE_RATE = 22050;
+#else
+constexpr int LAB_SAMPLE_RATE = 11025;
+#endif
+
+// Test pattern: the BrickBreaker hits, a triangle bass line and a noise burst,
+// one event every PATTERN_STEP_MS so several voices overlap at any time.
+const AudioEvent PATTERN[] = {
+    { WaveType::PULSE, 459.0f, 0.1f, 0.5f, 0.5f },
+    { WaveType::TRIANGLE, 110.0f, 0.4f, 0.8f, 0.5f },
+    { WaveType::PULSE, 226.0f, 0.1f, 0.5f, 0.25f },
+    { WaveType::NOISE, 4000.0f, 0.15f, 0.4f, 0.5f },
+    { WaveType::PULSE, 490.0f, 0.1f, 0.5f, 0.5f },
+    { WaveType::TRIANGLE, 146.8f, 0.4f, 0.8f, 0.5f },
+    { WaveType::PULSE, 880.0f, 0.2f, 0.5f, 0.125f },
+    { WaveType::NOISE, 1000.0f, 0.3f, 0.4f, 0.5f }
+};
+constexpr int PATTERN_LENGTH = sizeof(PATTERN) / sizeof(PATTERN[0]);
+constexpr unsigned long PATTERN_STEP_MS = 90;
+
+// AUDIO LATENCY page: buffer targets tried by the sweep, smallest first.
+const int SWEEP_TARGETS[] = { 256, 512, 768, 1024, 2048 };
+static_assert(sizeof(SWEEP_TARGETS) / sizeof(SWEEP_TARGETS[0]) == AudioLabScene::SweepSteps,
+              "One sweep result per target");
+
+// Outputs count as matching within 1/32 of full scale; pulse edges that land
+// one sample apart are the usual difference.
+constexpr int MATCH_TOLERANCE = 1024;
+
+// Bursts for the VOICES page, one entry every FLOOD_STEP_MS. Repeats are the
+// same event fired several times in one frame.
+struct FloodEvent {
+    AudioEvent event;
+    uint8_t priority;
+    uint8_t repeats;
+};
+
+const FloodEvent FLOOD[] = {
+    { { WaveType::PULSE, 459.0f, 0.1f, 0.5f, 0.5f }, 0, 5 },     // Brick hit with a particle burst
+    { { WaveType::PULSE, 880.0f, 0.12f, 0.4f, 0.25f }, 1, 1 },   // Shot
+    { { WaveType::PULSE, 1320.0f, 0.03f, 0.3f, 0.5f }, 0, 2 },   // Menu blip
+    { { WaveType::PULSE, 490.0f, 0.1f, 0.5f, 0.5f }, 0, 4 },     // Brick hit
+    { { WaveType::NOISE, 2000.0f, 0.35f, 0.7f, 0.5f }, 2, 1 },   // Explosion
+    { { WaveType::PULSE, 880.0f, 0.12f, 0.4f, 0.25f }, 1, 1 }    // Shot
+};
+constexpr int FLOOD_LENGTH = sizeof(FLOOD) / sizeof(FLOOD[0]);
+constexpr unsigned long FLOOD_STEP_MS = 30;
+
+const char* const STEAL_MODE_NAMES[] = { "NONE", "OLDEST", "QUIETEST" };
+
+// SEQUENCER page: a two-bar loop on three tracks.
+const MusicNote SEQ_BASS_NOTES[] = {
+    { Note::A, 2, 0.25f, 0.8f }, { Note::A, 2, 0.25f, 0.8f }, { Note::E, 2, 0.25f, 0.8f }, { Note::G, 2, 0.25f, 0.8f },
+    { Note::F, 2, 0.25f, 0.8f }, { Note::F, 2, 0.25f, 0.8f }, { Note::E, 2, 0.25f, 0.8f }, { Note::E, 2, 0.25f, 0.8f }
+};
+const MusicNote SEQ_LEAD_NOTES[] = {
+    { Note::A, 4, 0.375f, 0.4f }, { Note::C, 5, 0.125f, 0.4f }, { Note::E, 5, 0.25f, 0.4f }, { Note::D, 5, 0.25f, 0.4f },
+    { Note::C, 5, 0.375f, 0.4f }, { Note::B, 4, 0.125f, 0.4f }, { Note::Rest, 0, 0.25f, 0.0f }, { Note::E, 4, 0.25f, 0.4f }
+};
+const MusicNote SEQ_DRUM_NOTES[] = {
+    { Note::C, 3, 0.125f, 0.6f }, { Note::Rest, 0, 0.125f, 0.0f },
+    { Note::C, 7, 0.0625f, 0.3f }, { Note::Rest, 0, 0.1875f, 0.0f }
+};
+
+const MusicTrack SEQ_TRACKS[] = {
+    { SEQ_BASS_NOTES, sizeof(SEQ_BASS_NOTES) / sizeof(MusicNote), true, WaveType::TRIANGLE, 0.5f },
+    { SEQ_LEAD_NOTES, sizeof(SEQ_LEAD_NOTES) / sizeof(MusicNote), true, WaveType::PULSE, 0.25f },
+    { SEQ_DRUM_NOTES, sizeof(SEQ_DRUM_NOTES) / sizeof(MusicNote), true, WaveType::NOISE, 0.5f }
+};
+constexpr int SEQ_TRACK_COUNT = sizeof(SEQ_TRACKS) / sizeof(SEQ_TRACKS[0]);
+
+// SpaceInvaders' music runs from 1.0 up to about 1.9 as the horde descends.
+constexpr float SEQ_FAST_TEMPO = 1.9f;
+constexpr float SEQ_GLIDE_SECONDS = 2.0f;
+
+/**
+ * Note timing as a MusicPlayer::update(deltaTime) loop sees it: each track
+ * adds the frame's time and starts every note that has come due, on that
+ * frame. Records how late each start is against the note's true time.
+ */
+class FrameClockModel {
+public:
+    void reset() {
+        for (int i = 0; i < SEQ_TRACK_COUNT; ++i) {
+            elapsedMs[i] = 0.0f;
+            index[i] = 0;
+            started[i] = false;
+        }
+        resetStats();
+    }
+
+    void resetStats() {
+        onsets = 0;
+        lateTotalUs = 0;
+        lateWorstUs = 0;
+    }
+
+    void update(unsigned long deltaTime, float tempo) {
+        for (int t = 0; t < SEQ_TRACK_COUNT; ++t) {
+            if (!started[t]) {
+                // The first note starts with the track; only later notes can be late.
+                started[t] = true;
+                continue;
+            }
+            elapsedMs[t] += static_cast<float>(deltaTime) * tempo;
+            const MusicTrack& track = SEQ_TRACKS[t];
+            float noteMs = track.notes[index[t]].duration * 1000.0f;
+            while (elapsedMs[t] >= noteMs) {
+                elapsedMs[t] -= noteMs;
+                index[t] = (index[t] + 1) % track.count;
+                const unsigned long lateUs = static_cast<unsigned long>(elapsedMs[t] / tempo * 1000.0f);
+                lateTotalUs += lateUs;
+                if (lateUs > lateWorstUs) lateWorstUs = lateUs;
+                ++onsets;
+                noteMs = track.notes[index[t]].duration * 1000.0f;
+            }
+        }
+    }
+
+    unsigned long onsets = 0;
+    unsigned long lateTotalUs = 0;
+    unsigned long lateWorstUs = 0;
+
+private:
+    float elapsedMs[SEQ_TRACK_COUNT] = {};
+    int index[SEQ_TRACK_COUNT] = {};
+    bool started[SEQ_TRACK_COUNT] = {};
+};
+
+FrameClockModel frameModel;
+
+bool sameNote(const MusicNote& a, const MusicNote& b) {
+    if (a.note == Note::Rest || b.note == Note::Rest) return a.note == b.note && a.duration == b.duration;
+    return a.note == b.note && a.octave == b.octave && a.duration == b.duration && a.volume == b.volume;
+}
+
+// Decodes a packed track (two passes if it loops) and checks it against its table.
+bool trackMatchesSource(const common::PackedSong& song, int index, const MusicTrack& source) {
+    common::PackedTrackReader reader;
+    reader.begin(song, index);
+    const int notes = source.loop ? source.count * 2 : source.count;
+    for (int i = 0; i < notes; ++i) {
+        MusicNote note;
+        if (!reader.next(note) || !sameNote(note, source.notes[i % source.count])) return false;
+    }
+    return true;
+}
+
+bool packedMatchesSource(const common::PackedSong& song) {
+    for (int t = 0; t < SEQ_TRACK_COUNT; ++t) {
+        if (!trackMatchesSource(song, t, SEQ_TRACKS[t])) return false;
+    }
+    return true;
+}
+
+// The games' own music, run through the same converter to compare sizes.
+struct GameSong {
+    const char* label;
+    const MusicTrack* track;
+    const char* headerPath;  // Written on native by B on the SEQUENCER page
+    const char* headerName;
+};
+
+const GameSong GAME_SONGS[] = {
+    { "TICTACTOE BG", &tictactoe::music::BG_MUSIC, "tictactoe_bg_song.h", "TICTACTOE_BG_SONG" },
+    { "TICTACTOE WIN", &tictactoe::music::WIN_MUSIC, "tictactoe_win_song.h", "TICTACTOE_WIN_SONG" },
+    { "INVADERS BASS", &spaceinvaders::music::BGM_SLOW_TRACK, "invaders_bass_song.h", "INVADERS_BASS_SONG" },
+    { "BRICKBREAKER", &brickbreaker::music::BGM_TRACK, "brickbreaker_song.h", "BRICKBREAKER_SONG" }
+};
+constexpr int GAME_SONG_COUNT = sizeof(GAME_SONGS) / sizeof(GAME_SONGS[0]);
+
+bool gameSongMatch[GAME_SONG_COUNT] = {};
+
+// SFX CACHE page: constant events from the games, fired in turn.
+const AudioEvent SFX_EVENTS[] = {
+    brickbreaker::sfx::PADDLE_HIT,
+    brickbreaker::sfx::BRICK_HIT,
+    brickbreaker::sfx::WALL_HIT,
+    { WaveType::PULSE, 880.0f, 0.08f, 0.4f, 0.5f },  // SpaceInvaders player shot
+    brickbreaker::sfx::BRICK_HIT,
+    brickbreaker::sfx::START_GAME,
+    brickbreaker::sfx::PADDLE_HIT,
+    brickbreaker::sfx::LIFE_LOST
+};
+constexpr int SFX_COUNT = sizeof(SFX_EVENTS) / sizeof(SFX_EVENTS[0]);
+constexpr unsigned long SFX_STEP_MS = 60;
+
+// EFFECTS page: settings for each effect, and which ones A cycles through.
+constexpr float FX_LOW_PASS_HZ = 1800.0f;
+constexpr float FX_ECHO_MS = 90.0f;  // Fits EchoFrames at 22050 Hz
+constexpr float FX_ECHO_FEEDBACK = 0.45f;
+constexpr float FX_ECHO_WET = 0.5f;
+constexpr int FX_CRUSH_BITS = 6;
+constexpr int FX_CRUSH_HOLD = 2;
+
+struct EffectsPreset {
+    const char* name;
+    bool lowPass;
+    bool echo;
+    bool bitcrush;
+};
+
+const EffectsPreset FX_PRESETS[] = {
+    { "ALL", true, true, true },
+    { "LOW-PASS", true, false, false },
+    { "ECHO", false, true, false },
+    { "BITCRUSH", false, false, true },
+    { "DRY", false, false, false }
+};
+constexpr int FX_PRESET_COUNT = sizeof(FX_PRESETS) / sizeof(FX_PRESETS[0]);
+const char* const FX_NAMES[] = { "LOW-PASS", "ECHO", "BITCRUSH" };
+
+using LabMixer = common::FixedMixer<AudioLabScene::MaxVoices, AudioLabScene::BlockFrames>;
+
+// Everything the pages play through: the mixers, the audio task and its ring,
+// the SFX cache, the echo line and the packed songs. About 25 KB, so it is
+// allocated when the scene is entered and freed when it returns to the menu
+// rather than kept in static DRAM for the life of the program.
+struct Lab {
+    Lab()
+        : mixer(LAB_SAMPLE_RATE), sequencer(mixer), audioTask(LAB_SAMPLE_RATE), freeMixer(LAB_SAMPLE_RATE),
+          sampleMixer(LAB_SAMPLE_RATE), effects(LAB_SAMPLE_RATE) {
+        sampleMixer.setDeduplicate(false);
+        effects.setLowPass(FX_LOW_PASS_HZ);
+        effects.setEcho(FX_ECHO_MS, FX_ECHO_FEEDBACK, FX_ECHO_WET);
+        effects.setBitcrush(FX_CRUSH_BITS, FX_CRUSH_HOLD);
+    }
+
+    LabMixer mixer;
+    common::Sequencer<LabMixer, 3> sequencer;
+    common::AudioTask<AudioLabScene::MaxVoices, AudioLabScene::BlockFrames, 32, AudioLabScene::TaskBufferFrames> audioTask;
+    common::FixedMixer<AudioLabScene::FloodVoices, AudioLabScene::BlockFrames> freeMixer;
+    LabMixer sampleMixer;  // Plays the SFX cache
+    common::SfxCache<AudioLabScene::SfxBudgetBytes> sfxCache;
+    common::EffectsBus<AudioLabScene::EchoFrames> effects;
+
+    // The SEQUENCER page plays SEQ_TRACKS converted to the packed format.
+    common::PackedSongBuilder<256, SEQ_TRACK_COUNT, 8, 8, 8> packedSong;
+    common::PackedSongBuilder<64, 1, 8, 8, 8> gameSongs[GAME_SONG_COUNT];
+};
+
+Lab* lab = nullptr;
+
+#ifdef PLATFORM_NATIVE
+// Native builds double as the offline converter: each header can be compiled
+// into a game as constant data.
+bool writeSongHeaders() {
+    bool ok = lab->packedSong.writeHeader("lab_song.h", "LAB_SONG");
+    for (int i = 0; i < GAME_SONG_COUNT; ++i) {
+        ok = lab->gameSongs[i].writeHeader(GAME_SONGS[i].headerPath, GAME_SONGS[i].headerName) && ok;
+    }
+    return ok;
+}
+#endif
+
+constexpr int SCOPE_TOP = 16;
+constexpr int SCOPE_H = 60;
+
+/**
+ * Reference synthesizer: float phase in [0, 1) and a switch on the waveform
+ * for every voice of every sample, the way a straightforward playEvent mixer
+ * is written. Same waveforms, levels and LFSR as common::FixedMixer.
+ */
+class FloatReferenceMixer {
+public:
+    void reset(int rate) {
+        sampleRate = rate;
+        for (Voice& voice : voices) voice.active = false;
+    }
+
+    void play(const AudioEvent& event) {
+        for (Voice& voice : voices) {
+            if (voice.active) continue;
+            float cycles = event.frequency / static_cast<float>(sampleRate);
+            voice.type = event.type;
+            voice.phase = 0.0f;
+            voice.step = cycles > 0.5f ? 0.5f : cycles;
+            voice.duty = event.duty <= 0.0f ? 0.5f : event.duty;
+            voice.volume = event.volume;
+            voice.remaining = static_cast<int>(event.duration * static_cast<float>(sampleRate));
+            voice.lfsr = 1;
+            voice.active = voice.remaining > 0;
+            return;
+        }
+    }
+
+    void render(int16_t* out, int count) {
+        const float fullScale = 32767.0f / 4.0f;
+        for (int i = 0; i < count; ++i) {
+            float sample = 0.0f;
+            for (Voice& voice : voices) {
+                if (!voice.active) continue;
+                float value;
+                switch (voice.type) {
+                    case WaveType::PULSE:
+                        value = voice.phase < voice.duty ? 1.0f : -1.0f;
+                        break;
+                    case WaveType::TRIANGLE:
+                        value = voice.phase < 0.5f ? voice.phase * 4.0f - 1.0f : 3.0f - voice.phase * 4.0f;
+                        break;
+                    default:
+                        value = (voice.lfsr & 1u) ? 1.0f : -1.0f;
+                        break;
+                }
+                voice.phase += voice.step;
+                if (voice.phase >= 1.0f) {
+                    voice.phase -= 1.0f;
+                    if (voice.type == WaveType::NOISE) {
+                        const uint16_t feedback = static_cast<uint16_t>((voice.lfsr ^ (voice.lfsr >> 1)) & 1u);
+                        voice.lfsr = static_cast<uint16_t>((voice.lfsr >> 1) | (feedback << 14));
+                    }
+                }
+                if (voice.type == WaveType::NOISE) value = (voice.lfsr & 1u) ? 1.0f : -1.0f;
+                sample += value * voice.volume * fullScale;
+                if (--voice.remaining <= 0) voice.active = false;
+            }
+            sample = sample > 32767.0f ? 32767.0f : (sample < -32768.0f ? -32768.0f : sample);
+            out[i] = static_cast<int16_t>(sample);
+        }
+    }
+
+private:
+    struct Voice {
+        WaveType type = WaveType::PULSE;
+        float phase = 0.0f;
+        float step = 0.0f;
+        float duty = 0.5f;
+        float volume = 0.0f;
+        int remaining = 0;
+        uint16_t lfsr = 1;
+        bool active = false;
+    };
+
+    Voice voices[AudioLabScene::MaxVoices];
+    int sampleRate = LAB_SAMPLE_RATE;
+};
+
+FloatReferenceMixer floatMixer;
+
+// Samples a backend would have pulled during deltaTime (ms * rate, remainder carried).
+int takeElapsedSamples(unsigned long deltaTime, int sampleRate, unsigned long& remainder) {
+    remainder += deltaTime * static_cast<unsigned long>(sampleRate);
+    const int pending = static_cast<int>(remainder / 1000UL);
+    remainder %= 1000UL;
+    return pending;
+}
+
+} // namespace
+
+AudioLabScene::AudioLabScene()
+    : page(Page::MIXER), sampleRate(LAB_SAMPLE_RATE), sampleRemainder(0), patternTimer(0), patternIndex(0),
+      floatTotal(0), floatWorst(0), floatBlocks(0), comparedSamples(0), matchingSamples(0), gameTotal(0),
+      sequencerTotal(0), sequencerBlocks(0), frames(0), floatAvg(0), floatWorstAvg(0), fixedAvg(0),
+      fixedWorst(0), matchPermille(0), gameAvg(0), sequencerAvg(0), frameLateAvg(0), frameLateWorst(0),
+      seqLateAvg(0), seqLateWorst(0),
+      sweepStep(-1), sweepDone(0), sweepTimer(0), effectsPreset(0), fastTempo(false), packedMatch(false), hasReport(false) {
+    for (int i = 0; i < BlockFrames; ++i) {
+        fixedBlock[i] = 0;
+        floatBlock[i] = 0;
+        taskBlock[i] = 0;
+    }
+}
+
+AudioLabScene::~AudioLabScene() {
+    delete lab;
+    lab = nullptr;
+}
+
+void AudioLabScene::init() {
+    pr32::graphics::setPalette(pr32::graphics::PaletteType::PR32);
+
+    if (!lab) lab = new Lab();
+    if (!lab->packedSong.isValid()) {
+        for (const MusicTrack& track : SEQ_TRACKS) lab->packedSong.addTrack(track);
+        packedMatch = lab->packedSong.build() && packedMatchesSource(lab->packedSong.get());
+        for (int i = 0; i < GAME_SONG_COUNT; ++i) {
+            lab->gameSongs[i].addTrack(*GAME_SONGS[i].track);
+            gameSongMatch[i] = lab->gameSongs[i].build() && trackMatchesSource(lab->gameSongs[i].get(), 0, *GAME_SONGS[i].track);
+        }
+    }
+    // Pre-render once, in the order listed; whatever does not fit the budget stays live.
+    if (lab->sfxCache.getEntryCount() == 0 && lab->sfxCache.getRefusedCount() == 0) {
+        for (const AudioEvent& event : SFX_EVENTS) lab->sfxCache.prerender(event, sampleRate);
+    }
+    selectPage(Page::MIXER);
+}
+
+// The audio task only runs while its page is shown.
+void AudioLabScene::selectPage(Page next) {
+    page = next;
+    lab->audioTask.setBufferTarget(TaskBufferFrames);
+    sweepStep = -1;
+    if (page == Page::TASK || page == Page::LATENCY) {
+        lab->audioTask.start();
+    } else {
+        lab->audioTask.stop();
+    }
+
+    lab->mixer.setSampleRate(sampleRate);
+    floatMixer.reset(sampleRate);
+    if (page == Page::VOICES) {
+        lab->mixer.setPolyphony(ManagedPolyphony);
+        lab->mixer.setDeduplicate(true);
+        lab->freeMixer.setSampleRate(sampleRate);
+        lab->freeMixer.setDeduplicate(false);
+        lab->freeMixer.setStealMode(common::StealMode::NONE);
+    } else {
+        // The float reference has no voice manager: play every event on its own voice.
+        lab->mixer.setPolyphony(MaxVoices);
+        lab->mixer.setDeduplicate(false);
+    }
+#ifdef PLATFORM_NATIVE
+    wavWriter.close();
+#endif
+    // The EFFECTS page plays the sequencer's song through the bus.
+    if (page == Page::SEQUENCER || page == Page::EFFECTS) {
+        lab->sequencer.clear();
+        for (int i = 0; i < SEQ_TRACK_COUNT; ++i) {
+            if (packedMatch) {
+                lab->sequencer.addTrack(lab->packedSong.get(), i);
+            } else {
+                lab->sequencer.addTrack(SEQ_TRACKS[i]);
+            }
+        }
+        lab->sequencer.start();
+        fastTempo = false;
+        frameModel.reset();
+    } else {
+        lab->sequencer.stop();
+    }
+    if (page == Page::EFFECTS) {
+        lab->effects.reset();
+        applyEffectsPreset();
+    }
+    sampleRemainder = 0;
+    patternTimer = 0;
+    patternIndex = 0;
+    resetTotals();
+    hasReport = false;
+}
+
+void AudioLabScene::resetTotals() {
+    lab->mixer.resetStats();
+    lab->freeMixer.resetStats();
+    lab->sampleMixer.resetStats();
+    lab->sfxCache.resetPlayCounts();
+    lab->effects.resetStats();
+    lab->audioTask.resetStats();
+    floatTotal = 0;
+    floatWorst = 0;
+    floatBlocks = 0;
+    comparedSamples = 0;
+    matchingSamples = 0;
+    gameTotal = 0;
+    sequencerTotal = 0;
+    sequencerBlocks = 0;
+    frameModel.resetStats();
+    lab->sequencer.resetOnsetStats();
+    frames = 0;
+}
+
+void AudioLabScene::update(unsigned long deltaTime) {
+    Scene::update(deltaTime);
+
+    auto& input = engine.getInputManager();
+    const int pageCount = static_cast<int>(Page::COUNT);
+    const int index = static_cast<int>(page);
+    if (input.isButtonPressed(BTN_UP)) {
+        // Back to the menu (B already has a job on several pages). Deleting
+        // the lab stops the audio task; it is built again on the next visit.
+#ifdef PLATFORM_NATIVE
+        wavWriter.close();
+#endif
+        delete lab;
+        lab = nullptr;
+        engine.setScene(&menuScene);
+        return;
+    }
+    if (input.isButtonPressed(BTN_RIGHT)) {
+        selectPage(static_cast<Page>((index + 1) % pageCount));
+        return;
+    }
+    if (input.isButtonPressed(BTN_LEFT)) {
+        selectPage(static_cast<Page>((index + pageCount - 1) % pageCount));
+        return;
+    }
+    if (input.isButtonPressed(BTN_A)) {
+        if (page == Page::VOICES) {
+            const int mode = (static_cast<int>(lab->mixer.getStealMode()) + 1) % 3;
+            lab->mixer.setStealMode(static_cast<common::StealMode>(mode));
+        } else if (page == Page::SEQUENCER) {
+            fastTempo = !fastTempo;
+            lab->sequencer.setTempoFactor(fastTempo ? SEQ_FAST_TEMPO : 1.0f, SEQ_GLIDE_SECONDS);
+        } else if (page == Page::SFX_CACHE) {
+            engine.getAudioEngine().playEvent(SFX_EVENTS[patternIndex]);
+        } else if (page == Page::LATENCY) {
+            if (sweepStep < 0) {
+                sweepStep = 0;
+                sweepDone = 0;
+                sweepTimer = 0;
+                lab->audioTask.setBufferTarget(SWEEP_TARGETS[0]);
+            }
+        } else if (page == Page::EFFECTS) {
+            effectsPreset = (effectsPreset + 1) % FX_PRESET_COUNT;
+            applyEffectsPreset();
+        } else {
+            engine.getAudioEngine().playEvent(PATTERN[patternIndex]);
+        }
+    }
+
+    if (page == Page::TASK) {
+        if (input.isButtonPressed(BTN_B)) {
+            // Simulated frame hitch: the game core is busy, the audio task is not.
+            const unsigned long start = nowMicros();
+            while (nowMicros() - start < HitchMillis * 1000UL) {
+            }
+        }
+
+        // Everything the game core does for audio on this page: queue pushes and the backend read.
+        const unsigned long start = nowMicros();
+        firePattern(deltaTime);
+        readTaskElapsed(deltaTime);
+        gameTotal += nowMicros() - start;
+    } else if (page == Page::LATENCY) {
+        firePattern(deltaTime);
+        readTaskElapsed(deltaTime);
+        updateSweep(deltaTime);
+    } else if (page == Page::VOICES) {
+        fireFlood(deltaTime);
+        renderFloodElapsed(deltaTime);
+    } else if (page == Page::SEQUENCER) {
+#ifdef PLATFORM_NATIVE
+        if (input.isButtonPressed(BTN_B)) exportResult = writeSongHeaders() ? 1 : -1;
+#endif
+        frameModel.update(deltaTime, lab->sequencer.getTempoFactor());
+        renderSequencerElapsed(deltaTime);
+    } else if (page == Page::SFX_CACHE) {
+        fireSfx(deltaTime);
+        renderSfxElapsed(deltaTime);
+    } else if (page == Page::EFFECTS) {
+#ifdef PLATFORM_NATIVE
+        if (input.isButtonPressed(BTN_B) && !wavWriter.isOpen()) {
+            wavWriter.open("lab_effects.wav", sampleRate);
+        }
+#endif
+        renderEffectsElapsed(deltaTime);
+    } else {
+        firePattern(deltaTime);
+        renderElapsed(deltaTime);
+    }
+
+    if (++frames >= SamplesPerReport) {
+        const common::MixerStats& stats = lab->mixer.getStats();
+        floatAvg = floatBlocks ? floatTotal / floatBlocks : 0;
+        floatWorstAvg = floatWorst;
+        fixedAvg = stats.getAverageMicros();
+        fixedWorst = stats.worstBlockMicros;
+        matchPermille = comparedSamples ? static_cast<int>((matchingSamples * 1000UL) / comparedSamples) : 0;
+        gameAvg = gameTotal / static_cast<unsigned long>(frames);
+        // Counters keep running on the task page so underruns and drops stay visible.
+        taskReport = lab->audioTask.getStats();
+        freeReport = lab->freeMixer.getStats();
+        managedReport = stats;
+        sampleReport = lab->sampleMixer.getStats();
+        sequencerAvg = sequencerBlocks ? sequencerTotal / sequencerBlocks : 0;
+        frameLateAvg = frameModel.onsets ? frameModel.lateTotalUs / frameModel.onsets : 0;
+        frameLateWorst = frameModel.lateWorstUs;
+        // Sequencer lateness is in 16.16 output samples.
+        const common::OnsetStats& onsets = lab->sequencer.getOnsetStats();
+        const uint64_t lateUnitsPerUs = 65536ULL * static_cast<uint64_t>(sampleRate);
+        seqLateAvg = onsets.onsets
+            ? static_cast<unsigned long>(onsets.lateTotal / onsets.onsets * 1000000ULL / lateUnitsPerUs)
+            : 0;
+        seqLateWorst = static_cast<unsigned long>(onsets.lateWorst * 1000000ULL / lateUnitsPerUs);
+        for (int i = 0; i < LabEffects::EFFECT_COUNT; ++i) {
+            effectsReport[i] = lab->effects.getStats(static_cast<LabEffects::Effect>(i));
+        }
+        hasReport = true;
+
+        lab->mixer.resetStats();
+        lab->freeMixer.resetStats();
+        lab->sampleMixer.resetStats();
+        lab->effects.resetStats();
+        floatTotal = 0;
+        floatWorst = 0;
+        floatBlocks = 0;
+        comparedSamples = 0;
+        matchingSamples = 0;
+        gameTotal = 0;
+        sequencerTotal = 0;
+        sequencerBlocks = 0;
+        frameModel.resetStats();
+        lab->sequencer.resetOnsetStats();
+        frames = 0;
+    }
+}
+
+void AudioLabScene::firePattern(unsigned long deltaTime) {
+    patternTimer += deltaTime;
+    while (patternTimer >= PATTERN_STEP_MS) {
+        patternTimer -= PATTERN_STEP_MS;
+        patternIndex = (patternIndex + 1) % PATTERN_LENGTH;
+        if (page == Page::TASK || page == Page::LATENCY) {
+            lab->audioTask.playEvent(PATTERN[patternIndex]);
+        } else {
+            lab->mixer.play(PATTERN[patternIndex]);
+            floatMixer.play(PATTERN[patternIndex]);
+        }
+    }
+}
+
+// Renders the samples a backend would have pulled during deltaTime, one block at a time.
+void AudioLabScene::renderElapsed(unsigned long deltaTime) {
+    int pending = takeElapsedSamples(deltaTime, sampleRate, sampleRemainder);
+
+    while (pending > 0) {
+        const int count = pending < BlockFrames ? pending : BlockFrames;
+
+        const unsigned long start = nowMicros();
+        floatMixer.render(floatBlock, count);
+        const unsigned long elapsed = nowMicros() - start;
+        floatTotal += elapsed;
+        ++floatBlocks;
+        if (elapsed > floatWorst) floatWorst = elapsed;
+
+        lab->mixer.render(fixedBlock, count);
+
+        for (int i = 0; i < count; ++i) {
+            const int diff = fixedBlock[i] - floatBlock[i];
+            if (diff <= MATCH_TOLERANCE && diff >= -MATCH_TOLERANCE) ++matchingSamples;
+        }
+        comparedSamples += static_cast<unsigned long>(count);
+        pending -= count;
+    }
+}
+
+void AudioLabScene::fireFlood(unsigned long deltaTime) {
+    patternTimer += deltaTime;
+    while (patternTimer >= FLOOD_STEP_MS) {
+        patternTimer -= FLOOD_STEP_MS;
+        patternIndex = (patternIndex + 1) % FLOOD_LENGTH;
+        const FloodEvent& burst = FLOOD[patternIndex];
+        for (int i = 0; i < burst.repeats; ++i) {
+            lab->freeMixer.play(burst.event, burst.priority);
+            lab->mixer.play(burst.event, burst.priority);
+        }
+    }
+}
+
+void AudioLabScene::renderFloodElapsed(unsigned long deltaTime) {
+    int pending = takeElapsedSamples(deltaTime, sampleRate, sampleRemainder);
+
+    while (pending > 0) {
+        const int count = pending < BlockFrames ? pending : BlockFrames;
+        lab->freeMixer.render(floatBlock, count);
+        lab->mixer.render(fixedBlock, count);
+        pending -= count;
+    }
+}
+
+void AudioLabScene::fireSfx(unsigned long deltaTime) {
+    patternTimer += deltaTime;
+    while (patternTimer >= SFX_STEP_MS) {
+        patternTimer -= SFX_STEP_MS;
+        patternIndex = (patternIndex + 1) % SFX_COUNT;
+        lab->mixer.play(SFX_EVENTS[patternIndex]);
+        lab->sfxCache.play(lab->sampleMixer, SFX_EVENTS[patternIndex]);
+    }
+}
+
+// Live synthesis into fixedBlock, the cache into floatBlock; both timed by their mixers.
+void AudioLabScene::renderSfxElapsed(unsigned long deltaTime) {
+    int pending = takeElapsedSamples(deltaTime, sampleRate, sampleRemainder);
+
+    while (pending > 0) {
+        const int count = pending < BlockFrames ? pending : BlockFrames;
+        lab->mixer.render(fixedBlock, count);
+        lab->sampleMixer.render(floatBlock, count);
+        for (int i = 0; i < count; ++i) {
+            const int diff = fixedBlock[i] - floatBlock[i];
+            if (diff <= MATCH_TOLERANCE && diff >= -MATCH_TOLERANCE) ++matchingSamples;
+        }
+        comparedSamples += static_cast<unsigned long>(count);
+        pending -= count;
+    }
+}
+
+void AudioLabScene::renderSequencerElapsed(unsigned long deltaTime) {
+    int pending = takeElapsedSamples(deltaTime, sampleRate, sampleRemainder);
+
+    while (pending > 0) {
+        const int count = pending < BlockFrames ? pending : BlockFrames;
+        const unsigned long start = nowMicros();
+        lab->sequencer.render(fixedBlock, count);
+        sequencerTotal += nowMicros() - start;
+        ++sequencerBlocks;
+        pending -= count;
+    }
+}
+
+void AudioLabScene::applyEffectsPreset() {
+    const EffectsPreset& preset = FX_PRESETS[effectsPreset];
+    lab->effects.setEnabled(LabEffects::LOW_PASS, preset.lowPass);
+    lab->effects.setEnabled(LabEffects::ECHO, preset.echo);
+    lab->effects.setEnabled(LabEffects::BITCRUSH, preset.bitcrush);
+}
+
+// The song is mixed and then run through the bus; each stage is timed on its own.
+void AudioLabScene::renderEffectsElapsed(unsigned long deltaTime) {
+    int pending = takeElapsedSamples(deltaTime, sampleRate, sampleRemainder);
+
+    while (pending > 0) {
+        const int count = pending < BlockFrames ? pending : BlockFrames;
+        const unsigned long start = nowMicros();
+        lab->sequencer.render(fixedBlock, count);
+        sequencerTotal += nowMicros() - start;
+        ++sequencerBlocks;
+        lab->effects.process(fixedBlock, count);
+#ifdef PLATFORM_NATIVE
+        if (wavWriter.isOpen()) {
+            const int left = WavSeconds * sampleRate - static_cast<int>(wavWriter.getFrames());
+            wavWriter.write(fixedBlock, count < left ? count : left);
+            if (count >= left) wavWriter.close();
+        }
+#endif
+        pending -= count;
+    }
+}
+
+// Plays the backend for the audio task: pulls the samples that elapsed, in blocks.
+void AudioLabScene::readTaskElapsed(unsigned long deltaTime) {
+    int pending = takeElapsedSamples(deltaTime, sampleRate, sampleRemainder);
+
+    while (pending > 0) {
+        const int count = pending < BlockFrames ? pending : BlockFrames;
+        lab->audioTask.read(taskBlock, count);
+        pending -= count;
+    }
+}
+
+// Each step lowers the task's buffer target, lets the ring drain to it, then
+// counts underruns and latency for SweepMillis.
+void AudioLabScene::updateSweep(unsigned long deltaTime) {
+    if (sweepStep < 0) return;
+    const unsigned long before = sweepTimer;
+    sweepTimer += deltaTime;
+    if (before < SweepSettleMillis && sweepTimer >= SweepSettleMillis) {
+        lab->audioTask.resetStats();
+        return;
+    }
+    if (sweepTimer < SweepSettleMillis + SweepMillis) return;
+
+    const common::AudioTaskStats stats = lab->audioTask.getStats();
+    sweepResults[sweepStep] = { SWEEP_TARGETS[sweepStep], stats.underrunFrames, stats.getAverageLatencyFrames(),
+                                stats.worstLatencyFrames, stats.minBufferedFrames };
+    sweepDone = sweepStep + 1;
+    sweepTimer = 0;
+    if (++sweepStep >= SweepSteps) {
+        sweepStep = -1;
+        lab->audioTask.setBufferTarget(TaskBufferFrames);
+    } else {
+        lab->audioTask.setBufferTarget(SWEEP_TARGETS[sweepStep]);
+    }
+}
+
+void AudioLabScene::drawScope(pr32::graphics::Renderer& renderer, const int16_t* block) {
+    const int mid = SCOPE_TOP + SCOPE_H / 2;
+    renderer.drawLine(0, mid, DISPLAY_WIDTH - 1, mid, Color::DarkGray);
+
+    int previousY = mid;
+    for (int x = 0; x < DISPLAY_WIDTH; ++x) {
+        const int sample = block[(x * BlockFrames) / DISPLAY_WIDTH];
+        const int y = mid - (sample * (SCOPE_H / 2)) / 32768;
+        if (x > 0) renderer.drawLine(x - 1, previousY, x, y, Color::Green);
+        previousY = y;
+    }
+    renderer.drawLine(0, SCOPE_TOP + SCOPE_H + 2, DISPLAY_WIDTH - 1, SCOPE_TOP + SCOPE_H + 2, Color::DarkGray);
+}
+
+void AudioLabScene::drawMixerReport(pr32::graphics::Renderer& renderer, int y) {
+    char line[64];
+    const unsigned long budget = lab->mixer.getBlockBudgetMicros();
+    renderer.drawText("(us/block)   FLOAT  FIXED", 8, y, Color::Cyan, 1);
+    y += 10;
+    std::snprintf(line, sizeof(line), "AVERAGE     %6lu %6lu", floatAvg, fixedAvg);
+    renderer.drawText(line, 8, y, fixedAvg <= floatAvg ? Color::White : Color::Red, 1);
+    y += 10;
+    std::snprintf(line, sizeof(line), "WORST       %6lu %6lu", floatWorstAvg, fixedWorst);
+    renderer.drawText(line, 8, y, Color::White, 1);
+    y += 10;
+    // Share of the block's real-time length spent rendering it, in tenths of a percent.
+    const unsigned long floatLoad = budget ? (floatAvg * 1000UL) / budget : 0;
+    const unsigned long fixedLoad = budget ? (fixedAvg * 1000UL) / budget : 0;
+    std::snprintf(line, sizeof(line), "LOAD %%      %4lu.%lu %4lu.%lu",
+                  floatLoad / 10, floatLoad % 10, fixedLoad / 10, fixedLoad % 10);
+    renderer.drawText(line, 8, y, Color::White, 1);
+    y += 10;
+    std::snprintf(line, sizeof(line), "BLOCK BUDGET %lu us", budget);
+    renderer.drawText(line, 8, y, Color::Gray, 1);
+    y += 14;
+
+    std::snprintf(line, sizeof(line), "MATCH %d.%d%% OF SAMPLES", matchPermille / 10, matchPermille % 10);
+    renderer.drawText(line, 8, y, matchPermille >= 990 ? Color::Green : Color::Red, 1);
+    y += 14;
+
+    renderer.drawText("A: PLAY CURRENT EVENT", 8, y, Color::Gray, 1);
+}
+
+void AudioLabScene::drawTaskReport(pr32::graphics::Renderer& renderer, int y) {
+    char line[64];
+    const int core = lab->audioTask.getCore();
+    if (core >= 0) {
+        std::snprintf(line, sizeof(line), "MIXING ON CORE %d", core);
+    } else {
+        std::snprintf(line, sizeof(line), "MIXING ON A THREAD");
+    }
+    renderer.drawText(line, 8, y, Color::Cyan, 1);
+    y += 10;
+    std::snprintf(line, sizeof(line), "GAME CORE   %6lu us/frame", gameAvg);
+    renderer.drawText(line, 8, y, Color::White, 1);
+    y += 10;
+    std::snprintf(line, sizeof(line), "TASK WORST  %6lu us/block", taskReport.worstBlockMicros);
+    renderer.drawText(line, 8, y, taskReport.worstBlockMicros <= lab->mixer.getBlockBudgetMicros() ? Color::White : Color::Red, 1);
+    y += 10;
+    std::snprintf(line, sizeof(line), "QUEUE SENT %lu DROP %lu MAX %d", taskReport.commandsSent,
+                  taskReport.commandsDropped, taskReport.maxQueued);
+    renderer.drawText(line, 8, y, taskReport.commandsDropped == 0 ? Color::White : Color::Red, 1);
+    y += 10;
+    const unsigned long bufferedMs =
+        static_cast<unsigned long>(taskReport.bufferedFrames) * 1000UL / static_cast<unsigned long>(sampleRate);
+    std::snprintf(line, sizeof(line), "BUFFER %4d/%d (%lu ms)", taskReport.bufferedFrames, TaskBufferFrames, bufferedMs);
+    renderer.drawText(line, 8, y, Color::White, 1);
+    y += 14;
+
+    std::snprintf(line, sizeof(line), "UNDERRUN %lu FRAMES", taskReport.underrunFrames);
+    renderer.drawText(line, 8, y, taskReport.underrunFrames == 0 ? Color::Green : Color::Red, 1);
+    y += 14;
+
+    std::snprintf(line, sizeof(line), "A: PLAY EVENT  B: %lu MS HITCH", HitchMillis);
+    renderer.drawText(line, 8, y, Color::Gray, 1);
+}
+
+void AudioLabScene::drawLatencyReport(pr32::graphics::Renderer& renderer, int y) {
+    char line[64];
+    const unsigned long rate = static_cast<unsigned long>(sampleRate);
+    std::snprintf(line, sizeof(line), "TARGET %d  FILL %d  LOW %d", taskReport.bufferTarget, taskReport.bufferedFrames,
+                  taskReport.minBufferedFrames);
+    renderer.drawText(line, 8, y, Color::White, 1);
+    y += 10;
+    std::snprintf(line, sizeof(line), "LATENCY %lu MS  WORST %lu MS", taskReport.getAverageLatencyFrames() * 1000UL / rate,
+                  taskReport.worstLatencyFrames * 1000UL / rate);
+    renderer.drawText(line, 8, y, Color::White, 1);
+    y += 10;
+    std::snprintf(line, sizeof(line), "UNDERRUN %lu  READ WORST %lu us", taskReport.underrunFrames,
+                  taskReport.worstReadMicros);
+    renderer.drawText(line, 8, y, taskReport.underrunFrames == 0 ? Color::White : Color::Red, 1);
+    y += 14;
+
+    renderer.drawText("BUFFER  UNDERRUN  LATENCY MS", 8, y, Color::Cyan, 1);
+    y += 10;
+    int safe = -1;
+    for (int i = 0; i < sweepDone; ++i) {
+        const SweepResult& result = sweepResults[i];
+        std::snprintf(line, sizeof(line), "%5d %9lu  %4lu / %lu", result.target, result.underrunFrames,
+                      result.averageLatencyFrames * 1000UL / rate, result.worstLatencyFrames * 1000UL / rate);
+        renderer.drawText(line, 8, y, result.underrunFrames == 0 ? Color::White : Color::Red, 1);
+        y += 10;
+        if (safe < 0 && result.underrunFrames == 0) safe = i;
+    }
+    y += 4;
+
+    if (sweepStep >= 0) {
+        std::snprintf(line, sizeof(line), "SWEEPING %d/%d: BUFFER %d", sweepStep + 1, SweepSteps,
+                      SWEEP_TARGETS[sweepStep]);
+        renderer.drawText(line, 8, y, Color::Yellow, 1);
+    } else if (sweepDone == SweepSteps) {
+        if (safe >= 0) {
+            std::snprintf(line, sizeof(line), "LOWEST SAFE BUFFER %d", sweepResults[safe].target);
+        } else {
+            std::snprintf(line, sizeof(line), "EVERY BUFFER UNDERRAN");
+        }
+        renderer.drawText(line, 8, y, safe >= 0 ? Color::Green : Color::Red, 1);
+    }
+    y += 10;
+    renderer.drawText("A: RUN BUFFER SWEEP", 8, y, Color::Gray, 1);
+}
+
+// The backend side of the audio task, in the debug overlay's corner.
+void AudioLabScene::drawAudioOverlay(pr32::graphics::Renderer& renderer) {
+#ifdef PIXELROOT32_ENABLE_DEBUG_OVERLAY
+    if (!lab->audioTask.isRunning()) return;
+    const common::AudioTaskStats stats = lab->audioTask.getStats();
+    char buffer[48];
+    std::snprintf(buffer, sizeof(buffer), "AUD FILL %d UR %lu CB %luUS LAT %lu", stats.bufferedFrames,
+                  stats.underrunFrames, stats.worstReadMicros, static_cast<unsigned long>(stats.worstLatencyFrames));
+    renderer.drawText(buffer, 4, DISPLAY_HEIGHT - 10, Color::DarkGray, 1);
+#else
+    (void)renderer;
+#endif
+}
+
+void AudioLabScene::drawVoicesReport(pr32::graphics::Renderer& renderer, int y) {
+    char line[64];
+    renderer.drawText("(us/block)    FREE MANAGED", 8, y, Color::Cyan, 1);
+    y += 10;
+    std::snprintf(line, sizeof(line), "AVERAGE     %6lu %6lu", freeReport.getAverageMicros(),
+                  managedReport.getAverageMicros());
+    renderer.drawText(line, 8, y, Color::White, 1);
+    y += 10;
+    std::snprintf(line, sizeof(line), "WORST       %6lu %6lu", freeReport.worstBlockMicros,
+                  managedReport.worstBlockMicros);
+    renderer.drawText(line, 8, y, Color::White, 1);
+    y += 10;
+    std::snprintf(line, sizeof(line), "PEAK VOICES %6d %6d", freeReport.peakVoices, managedReport.peakVoices);
+    renderer.drawText(line, 8, y, managedReport.peakVoices <= ManagedPolyphony ? Color::White : Color::Red, 1);
+    y += 14;
+
+    std::snprintf(line, sizeof(line), "STARTED %lu  MERGED %lu", managedReport.started, managedReport.deduplicated);
+    renderer.drawText(line, 8, y, Color::White, 1);
+    y += 10;
+    std::snprintf(line, sizeof(line), "STOLEN %lu  DROPPED %lu", managedReport.stolen, managedReport.dropped);
+    renderer.drawText(line, 8, y, Color::White, 1);
+    y += 14;
+
+    std::snprintf(line, sizeof(line), "A: STEAL %s",
+                  STEAL_MODE_NAMES[static_cast<int>(lab->mixer.getStealMode())]);
+    renderer.drawText(line, 8, y, Color::Gray, 1);
+}
+
+void AudioLabScene::drawSequencerReport(pr32::graphics::Renderer& renderer, int y) {
+    char line[64];
+    // Tempo in hundredths, so it prints without float formatting.
+    const int tempo = static_cast<int>(lab->sequencer.getTempoFactor() * 100.0f + 0.5f);
+    std::snprintf(line, sizeof(line), "TEMPO %d.%02d  CLOCK %lu", tempo / 100, tempo % 100,
+                  static_cast<unsigned long>(lab->sequencer.getSampleClock()));
+    renderer.drawText(line, 8, y, Color::White, 1);
+    y += 10;
+    std::snprintf(line, sizeof(line), "NOTES BASS %lu LEAD %lu DRUM %lu", lab->sequencer.getNotesStarted(0),
+                  lab->sequencer.getNotesStarted(1), lab->sequencer.getNotesStarted(2));
+    renderer.drawText(line, 8, y, Color::White, 1);
+    y += 14;
+
+    renderer.drawText("(song bytes)   TABLE PACKED", 8, y, Color::Cyan, 1);
+    y += 10;
+    if (packedMatch) {
+        std::snprintf(line, sizeof(line), "%-14s %5d %6d", "LAB SONG", lab->packedSong.getSourceBytes(),
+                      lab->packedSong.getPackedBytes());
+    } else {
+        std::snprintf(line, sizeof(line), "%-14s PACK FAILED", "LAB SONG");
+    }
+    renderer.drawText(line, 8, y, packedMatch ? Color::White : Color::Red, 1);
+    y += 10;
+    for (int i = 0; i < GAME_SONG_COUNT; ++i) {
+        if (gameSongMatch[i]) {
+            std::snprintf(line, sizeof(line), "%-14s %5d %6d", GAME_SONGS[i].label, lab->gameSongs[i].getSourceBytes(),
+                          lab->gameSongs[i].getPackedBytes());
+        } else {
+            std::snprintf(line, sizeof(line), "%-14s PACK FAILED", GAME_SONGS[i].label);
+        }
+        renderer.drawText(line, 8, y, gameSongMatch[i] ? Color::White : Color::Red, 1);
+        y += 10;
+    }
+    y += 4;
+
+    renderer.drawText("(note start, ms late)", 8, y, Color::Cyan, 1);
+    y += 10;
+    std::snprintf(line, sizeof(line), "PER FRAME   AVG %lu.%lu  WORST %lu.%lu", frameLateAvg / 1000,
+                  (frameLateAvg % 1000) / 100, frameLateWorst / 1000, (frameLateWorst % 1000) / 100);
+    renderer.drawText(line, 8, y, Color::White, 1);
+    y += 10;
+    // Sub-sample values, so three decimals.
+    std::snprintf(line, sizeof(line), "SEQUENCER   AVG %u.%03u  WORST %u.%03u",
+                  static_cast<unsigned>(seqLateAvg / 1000), static_cast<unsigned>(seqLateAvg % 1000),
+                  static_cast<unsigned>(seqLateWorst / 1000), static_cast<unsigned>(seqLateWorst % 1000));
+    renderer.drawText(line, 8, y, Color::White, 1);
+    y += 12;
+
+    std::snprintf(line, sizeof(line), "SEQ+MIX %lu us/block", sequencerAvg);
+    renderer.drawText(line, 8, y, Color::White, 1);
+    y += 12;
+
+    const int target = fastTempo ? 100 : static_cast<int>(SEQ_FAST_TEMPO * 100.0f + 0.5f);
+    std::snprintf(line, sizeof(line), "A: TEMPO %d.%02d", target / 100, target % 100);
+    renderer.drawText(line, 8, y, Color::Gray, 1);
+#ifdef PLATFORM_NATIVE
+    const char* status = "B: WRITE .H";
+    if (exportResult > 0) status = "WROTE .H";
+    if (exportResult < 0) status = "WRITE FAILED";
+    renderer.drawText(status, 130, y, exportResult < 0 ? Color::Red : Color::Gray, 1);
+#endif
+}
+
+void AudioLabScene::drawSfxReport(pr32::graphics::Renderer& renderer, int y) {
+    char line[64];
+    renderer.drawText("(us/block)    LIVE CACHED", 8, y, Color::Cyan, 1);
+    y += 10;
+    std::snprintf(line, sizeof(line), "AVERAGE     %6lu %6lu", managedReport.getAverageMicros(),
+                  sampleReport.getAverageMicros());
+    renderer.drawText(line, 8, y, Color::White, 1);
+    y += 10;
+    std::snprintf(line, sizeof(line), "WORST       %6lu %6lu", managedReport.worstBlockMicros,
+                  sampleReport.worstBlockMicros);
+    renderer.drawText(line, 8, y, Color::White, 1);
+    y += 10;
+    std::snprintf(line, sizeof(line), "MATCH %d.%d%% OF SAMPLES", matchPermille / 10, matchPermille % 10);
+    renderer.drawText(line, 8, y, matchPermille >= 990 ? Color::Green : Color::Red, 1);
+    y += 14;
+
+    std::snprintf(line, sizeof(line), "CACHE %d/%d B  %d SFX  %d LIVE", lab->sfxCache.getUsedBytes(),
+                  lab->sfxCache.getBudgetBytes(), lab->sfxCache.getEntryCount(), lab->sfxCache.getRefusedCount());
+    renderer.drawText(line, 8, y, Color::White, 1);
+    y += 10;
+    std::snprintf(line, sizeof(line), "PLAYS  CACHED %lu  LIVE %lu", lab->sfxCache.getCachedPlays(),
+                  lab->sfxCache.getLivePlays());
+    renderer.drawText(line, 8, y, Color::White, 1);
+    y += 14;
+
+    renderer.drawText("A: PLAY CURRENT EVENT", 8, y, Color::Gray, 1);
+}
+
+void AudioLabScene::drawEffectsReport(pr32::graphics::Renderer& renderer, int y) {
+    char line[64];
+    const unsigned long budget = lab->mixer.getBlockBudgetMicros();
+    renderer.drawText("(us/block)      AVG  WORST", 8, y, Color::Cyan, 1);
+    y += 10;
+    unsigned long effectsTotal = 0;
+    for (int i = 0; i < LabEffects::EFFECT_COUNT; ++i) {
+        const common::EffectStats& stats = effectsReport[i];
+        const bool on = lab->effects.isEnabled(static_cast<LabEffects::Effect>(i));
+        if (on) {
+            std::snprintf(line, sizeof(line), "%-10s  %6lu %6lu", FX_NAMES[i], stats.getAverageMicros(),
+                          stats.worstMicros);
+            effectsTotal += stats.getAverageMicros();
+        } else {
+            std::snprintf(line, sizeof(line), "%-10s     OFF", FX_NAMES[i]);
+        }
+        renderer.drawText(line, 8, y, on ? Color::White : Color::DarkGray, 1);
+        y += 10;
+    }
+    std::snprintf(line, sizeof(line), "SEQ+MIX     %6lu", sequencerAvg);
+    renderer.drawText(line, 8, y, Color::White, 1);
+    y += 10;
+    // Tenths of a percent of the block's real-time length, as on the mixer page.
+    const unsigned long load = budget ? (effectsTotal * 1000UL) / budget : 0;
+    std::snprintf(line, sizeof(line), "EFFECTS LOAD %lu.%lu%% OF %lu us", load / 10, load % 10, budget);
+    // The bus gets a quarter of the block; the mixer and sequencer need the rest.
+    renderer.drawText(line, 8, y, effectsTotal <= budget / 4 ? Color::Green : Color::Red, 1);
+    y += 10;
+    std::snprintf(line, sizeof(line), "ECHO LINE %d B", LabEffects::getEchoBytes());
+    renderer.drawText(line, 8, y, Color::Gray, 1);
+    y += 14;
+
+#ifdef PLATFORM_NATIVE
+    const unsigned long recordedTenths = wavWriter.getFrames() * 10UL / static_cast<unsigned long>(sampleRate);
+    if (wavWriter.isOpen()) {
+        std::snprintf(line, sizeof(line), "RECORDING %lu.%lu S", recordedTenths / 10, recordedTenths % 10);
+        renderer.drawText(line, 8, y, Color::Red, 1);
+    } else if (wavWriter.getFrames() > 0) {
+        std::snprintf(line, sizeof(line), "WROTE %lu.%lu S TO LAB_EFFECTS.WAV", recordedTenths / 10,
+                      recordedTenths % 10);
+        renderer.drawText(line, 8, y, Color::Green, 1);
+    }
+    y += 10;
+    std::snprintf(line, sizeof(line), "A: %s  B: RECORD WAV", FX_PRESETS[effectsPreset].name);
+#else
+    std::snprintf(line, sizeof(line), "A: %s", FX_PRESETS[effectsPreset].name);
+#endif
+    renderer.drawText(line, 8, y, Color::Gray, 1);
+}
+
+void AudioLabScene::draw(pr32::graphics::Renderer& renderer) {
+    if (!lab) return;  // Left for the menu this frame
+
+    static const char* const TITLES[] = { "AUDIO MIXER", "AUDIO TASK", "AUDIO LATENCY", "VOICE MANAGER", "SEQUENCER", "SFX CACHE",
+                                          "EFFECTS BUS" };
+    renderer.drawTextCentered(TITLES[static_cast<int>(page)], 4, Color::White, 1);
+    const bool taskPage = page == Page::TASK || page == Page::LATENCY;
+    drawScope(renderer, taskPage ? taskBlock : fixedBlock);
+
+    char line[64];
+    int y = SCOPE_TOP + SCOPE_H + 8;
+    std::snprintf(line, sizeof(line), "%d HZ  BLOCK %d  VOICES %d", sampleRate, BlockFrames,
+                  lab->mixer.getPolyphony());
+    renderer.drawText(line, 8, y, Color::Yellow, 1);
+    y += 14;
+
+    if (!hasReport) {
+        renderer.drawTextCentered("MEASURING...", y, Color::Gray, 1);
+    } else if (page == Page::TASK) {
+        drawTaskReport(renderer, y);
+    } else if (page == Page::LATENCY) {
+        drawLatencyReport(renderer, y);
+    } else if (page == Page::VOICES) {
+        drawVoicesReport(renderer, y);
+    } else if (page == Page::SEQUENCER) {
+        drawSequencerReport(renderer, y);
+    } else if (page == Page::SFX_CACHE) {
+        drawSfxReport(renderer, y);
+    } else if (page == Page::EFFECTS) {
+        drawEffectsReport(renderer, y);
+    } else {
+        drawMixerReport(renderer, y);
+    }
+
+    Scene::draw(renderer);
+    drawAudioOverlay(renderer);
+}
+
+}
@@ -0,0 +1,187 @@
+#pragma once
+#include "core/Scene.h"
+#include "graphics/Renderer.h"
+#include "EngineConfig.h"
+#include "examples/Common/FixedMixer.h"
+#include "examples/Common/AudioTask.h"
+#include "examples/Common/EffectsBus.h"
+#include "examples/Common/WavWriter.h"
+
+namespace audiolab {
+
+/**
+ * @brief Measures the sample-side audio path against live float synthesis.
+ *
+ * The scene keeps a short pattern of test events (the BrickBreaker hits, a
+ * triangle bass and a noise burst) playing and reports every
+ * SamplesPerReport frames. LEFT/RIGHT switch pages and UP returns to the
+ * menu; A also sends the current pattern event to the engine's AudioEngine,
+ * so the measured sound can be heard. None of the pages drive a backend.
+ *
+ * Pages:
+ * - AUDIO MIXER: a per-sample float reference, written the way a naive
+ *   synthesizer loops over voices for every sample, against
+ *   common::FixedMixer. Every frame both render the audio that elapsed, in
+ *   blocks of the same size; the page prints the average and worst
+ *   microseconds per block, the share of the block's real-time budget, and
+ *   how closely the two outputs agree.
+ * - AUDIO TASK: the pattern goes through common::AudioTask, which mixes on
+ *   the other ESP32 core (a thread on native). The scene plays the backend,
+ *   reading the elapsed samples back each frame, and prints what the game
+ *   core still spends on audio, the queue and buffer levels, and underruns.
+ *   B stalls the game loop for HitchMillis to show the buffer riding over
+ *   a frame hitch.
+ * - AUDIO LATENCY: the same task, with its buffer level and low-water mark,
+ *   the slowest read() and each event's latency in samples. A sweeps the
+ *   task's buffer target through SweepSteps sizes, SweepMillis each, and
+ *   reports the lowest one that did not underrun.
+ * - VOICES: bursts like BrickBreaker's brick hits with particles, shots,
+ *   explosions and menu blips flood two mixers: one with FloodVoices free
+ *   voices and no limits, and one capped at ManagedPolyphony voices with
+ *   deduplication, priorities and stealing. The page prints the cost of
+ *   each and the managed mixer's counters; A cycles the steal mode.
+ * - SEQUENCER: bass, lead and drum tracks play together on a
+ *   common::Sequencer, which starts notes on their exact sample. The tracks
+ *   are converted to the packed music format at init and streamed from it.
+ *   The games' music tables (TicTacToe, the SpaceInvaders bass line,
+ *   BrickBreaker) go through the same converter, and the page shows the
+ *   table and packed size of each song. Next to it, a model of a per-frame
+ *   MusicPlayer shows how late its notes would start. A glides the tempo
+ *   between 1.0 and SpaceInvaders' top speed. On native, B writes every
+ *   packed song out as a header.
+ * - SFX CACHE: BrickBreaker's sound effects and the SpaceInvaders shot,
+ *   synthesized live on one mixer and played from a common::SfxCache of
+ *   pre-rendered 8-bit samples on another. The page compares the cost of
+ *   the two, checks that they sound the same, and shows what fits in the
+ *   SfxBudgetBytes budget.
+ * - EFFECTS BUS: the sequencer's song through a common::EffectsBus
+ *   (low-pass, echo, bitcrush). The page prints each effect's cost per
+ *   block against the block budget; A cycles which effects run. On native,
+ *   B records WavSeconds of the output to lab_effects.wav.
+ *
+ * The top band is a scope of the last block of the current page's output.
+ */
+class AudioLabScene : public pixelroot32::core::Scene {
+public:
+    AudioLabScene();
+    ~AudioLabScene();
+    void init() override;
+    void update(unsigned long deltaTime) override;
+    void draw(pixelroot32::graphics::Renderer& renderer) override;
+
+    static constexpr int BlockFrames = 128;
+    static constexpr int MaxVoices = 8;
+    static constexpr int TaskBufferFrames = 2048;
+    static constexpr int FloodVoices = 16;
+    static constexpr int ManagedPolyphony = 4;
+    static constexpr int SfxBudgetBytes = 8192;
+    static constexpr int EchoFrames = 2048;
+    static constexpr int WavSeconds = 5;
+    static constexpr int SweepSteps = 5;
+
+private:
+    enum class Page {
+        MIXER,
+        TASK,
+        LATENCY,
+        VOICES,
+        SEQUENCER,
+        SFX_CACHE,
+        EFFECTS,
+        COUNT
+    };
+
+    static constexpr int SamplesPerReport = 30;       // Frames averaged per report
+    static constexpr unsigned long HitchMillis = 60;  // Stall injected by B
+    static constexpr unsigned long SweepMillis = 2000;       // Measured per buffer size
+    static constexpr unsigned long SweepSettleMillis = 300;  // Ring drains to the new size first
+
+    struct SweepResult {
+        int target;
+        unsigned long underrunFrames;
+        uint32_t averageLatencyFrames;
+        uint32_t worstLatencyFrames;
+        int minBufferedFrames;
+    };
+
+    void selectPage(Page next);
+    void resetTotals();
+    void renderElapsed(unsigned long deltaTime);
+    void readTaskElapsed(unsigned long deltaTime);
+    void updateSweep(unsigned long deltaTime);
+    void firePattern(unsigned long deltaTime);
+    void fireFlood(unsigned long deltaTime);
+    void renderFloodElapsed(unsigned long deltaTime);
+    void renderSequencerElapsed(unsigned long deltaTime);
+    void fireSfx(unsigned long deltaTime);
+    void renderSfxElapsed(unsigned long deltaTime);
+    void applyEffectsPreset();
+    void renderEffectsElapsed(unsigned long deltaTime);
+    void drawScope(pixelroot32::graphics::Renderer& renderer, const int16_t* block);
+    void drawMixerReport(pixelroot32::graphics::Renderer& renderer, int y);
+    void drawTaskReport(pixelroot32::graphics::Renderer& renderer, int y);
+    void drawLatencyReport(pixelroot32::graphics::Renderer& renderer, int y);
+    void drawAudioOverlay(pixelroot32::graphics::Renderer& renderer);
+    void drawVoicesReport(pixelroot32::graphics::Renderer& renderer, int y);
+    void drawSequencerReport(pixelroot32::graphics::Renderer& renderer, int y);
+    void drawSfxReport(pixelroot32::graphics::Renderer& renderer, int y);
+    void drawEffectsReport(pixelroot32::graphics::Renderer& renderer, int y);
+
+    // The mixers, the audio task, the SFX cache and the effects bus are in
+    // AudioLabScene.cpp's Lab, allocated by init() and freed on leaving.
+    using LabEffects = common::EffectsBus<EchoFrames>;
+#ifdef PLATFORM_NATIVE
+    common::WavWriter wavWriter;
+    // Result of the last B song export: 0 none yet, 1 written, -1 failed.
+    int exportResult = 0;
+#endif
+
+    Page page;
+    int sampleRate;
+    unsigned long sampleRemainder;  // Sub-sample time carried between frames (ms * rate)
+    unsigned long patternTimer;
+    int patternIndex;
+
+    int16_t fixedBlock[BlockFrames];
+    int16_t floatBlock[BlockFrames];
+    int16_t taskBlock[BlockFrames];
+
+    // Totals for the current report window.
+    unsigned long floatTotal;
+    unsigned long floatWorst;
+    unsigned long floatBlocks;
+    unsigned long comparedSamples;
+    unsigned long matchingSamples;
+    unsigned long gameTotal;  // Game-core audio time (task page)
+    unsigned long sequencerTotal;
+    unsigned long sequencerBlocks;
+    int frames;
+
+    // Last published report.
+    unsigned long floatAvg;
+    unsigned long floatWorstAvg;
+    unsigned long fixedAvg;
+    unsigned long fixedWorst;
+    int matchPermille;
+    unsigned long gameAvg;
+    unsigned long sequencerAvg;
+    unsigned long frameLateAvg;    // Per-frame player onset lateness, us
+    unsigned long frameLateWorst;
+    unsigned long seqLateAvg;      // Sequencer onset error against the score, us
+    unsigned long seqLateWorst;
+    common::AudioTaskStats taskReport;
+    SweepResult sweepResults[SweepSteps];
+    int sweepStep;  // Step being measured, -1 when no sweep is running
+    int sweepDone;  // Steps with results
+    unsigned long sweepTimer;
+    common::MixerStats freeReport;
+    common::MixerStats managedReport;
+    common::MixerStats sampleReport;
+    common::EffectStats effectsReport[LabEffects::EFFECT_COUNT];
+    int effectsPreset;
+    bool fastTempo;  // Sequencer page: gliding to (or at) the fast tempo
+    bool packedMatch;  // Packed song decodes back to the source tables
+    bool hasReport;
+};
+
+}
@@ -0,0 +1,332 @@
+#pragma once
+#include "audio/AudioTypes.h"
+#include "BenchTimer.h"
+#include "FixedMixer.h"
+#include "SpscRing.h"
+#include <atomic>
+#include <cstdint>
+
+#ifdef PLATFORM_NATIVE
+#include <chrono>
+#include <thread>
+#else
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+namespace common {
+
+/** @brief A request from game code to the audio task. */
+struct AudioCommand {
+    enum class Type : uint8_t {
+        PLAY_EVENT,
+        STOP_ALL
+    };
+
+    Type type = Type::PLAY_EVENT;
+    uint8_t priority = 0;  // See FixedMixer::play()
+    uint32_t sentAtFrame = 0;  // Frames read() had delivered when the command was sent
+    pixelroot32::audio::AudioEvent event{};
+};
+
+/** @brief Counters for both sides of an AudioTask. */
+struct AudioTaskStats {
+    unsigned long commandsSent = 0;     // Accepted by the command queue
+    unsigned long commandsDropped = 0;  // Queue was full
+    int maxQueued = 0;                  // Command queue high-water mark
+    unsigned long blocks = 0;           // Blocks rendered by the task
+    unsigned long worstBlockMicros = 0;
+    unsigned long underrunFrames = 0;   // Frames read() had to fill with silence
+    int bufferedFrames = 0;             // Rendered frames waiting to be read
+    int minBufferedFrames = 0;          // Lowest level read() found since the reset
+    int bufferTarget = 0;               // Frames the task keeps rendered ahead
+    unsigned long worstReadMicros = 0;  // Slowest read(), the backend callback's share
+    unsigned long latencyEvents = 0;    // Events whose latency was measured
+    unsigned long totalLatencyFrames = 0;
+    uint32_t worstLatencyFrames = 0;    // Event sent to its first sample reaching read()
+
+    uint32_t getAverageLatencyFrames() const {
+        return latencyEvents ? static_cast<uint32_t>(totalLatencyFrames / latencyEvents) : 0;
+    }
+};
+
+/**
+ * @brief Runs a FixedMixer on its own task, fed through lock-free rings.
+ *
+ * Game code never touches the mixer. playEvent() and stopAll() push an
+ * AudioCommand into a single-producer/single-consumer ring and return at
+ * once; the audio task drains that ring, then renders BlockFrames-sample
+ * blocks until the output ring holds the buffer target (all BufferFrames
+ * unless setBufferTarget() lowers it), and sleeps for about half a block. The output side, read(), is what a backend callback calls:
+ * it pops rendered samples and fills any shortfall with silence, counting it
+ * as an underrun.
+ *
+ * Both sides are instrumented: the output ring's level and low-water mark,
+ * underruns, the slowest read(), and each event's latency in samples. The
+ * latency is measured from the output position when playEvent() was called
+ * to the position where the event's first sample was rendered, so it covers
+ * the command queue and everything buffered ahead of it. setBufferTarget()
+ * lowers how far ahead the task renders, at run time, to find the smallest
+ * buffer that does not underrun.
+ *
+ * On ESP32 the task is pinned to core 0 (PRO_CPU), leaving core 1, where the
+ * Arduino loop and rendering run, to the game; a frame hitch on core 1 no
+ * longer stops audio from being rendered, and the output ring carries
+ * BufferFrames of audio across it. The native build uses a std::thread, so
+ * the same code runs, and can be debugged, on a desktop.
+ *
+ * There is one producer (the game loop) and one consumer (read()'s caller);
+ * calling either side from more threads needs a lock around it.
+ */
+template <int MaxVoices, int BlockFrames = 128, int QueueSize = 32, int BufferFrames = 1024>
+class AudioTask {
+public:
+    static_assert(BufferFrames >= BlockFrames * 2, "AudioTask output ring should hold at least two blocks");
+
+    explicit AudioTask(int sampleRate = 22050) : mixer(sampleRate) {}
+    ~AudioTask() { stop(); }
+
+    AudioTask(const AudioTask&) = delete;
+    AudioTask& operator=(const AudioTask&) = delete;
+
+    /**
+     * @brief Starts the task; does nothing if it is already running.
+     *
+     * Returns once the task has filled the output ring, so the first read()
+     * does not start with an underrun.
+     */
+    bool start() {
+        if (running.load()) return true;
+        running.store(true);
+        primed.store(false);
+#ifdef PLATFORM_NATIVE
+        worker = std::thread([this]() { run(); });
+        while (!primed.load()) std::this_thread::yield();
+#else
+        finished.store(false);
+        if (xTaskCreatePinnedToCore(taskEntry, "pr32-audio", 4096, this, 5, &handle, 0) != pdPASS) {
+            running.store(false);
+            return false;
+        }
+        while (!primed.load()) vTaskDelay(1);
+#endif
+        return true;
+    }
+
+    /** @brief Stops the task and waits for it to exit. */
+    void stop() {
+        if (!running.load()) return;
+        running.store(false);
+#ifdef PLATFORM_NATIVE
+        if (worker.joinable()) worker.join();
+#else
+        while (!finished.load()) vTaskDelay(1);
+        handle = nullptr;
+#endif
+    }
+
+    bool isRunning() const { return running.load(); }
+
+    /**
+     * @brief Frames the task keeps rendered ahead, from BlockFrames to BufferFrames.
+     *
+     * Lower targets cut latency; a target below what the backend pulls between
+     * two wake-ups of the task underruns. Takes effect as the ring drains.
+     */
+    void setBufferTarget(int frames) {
+        frames = frames < BlockFrames ? BlockFrames : (frames > BufferFrames ? BufferFrames : frames);
+        bufferTarget.store(frames, std::memory_order_relaxed);
+    }
+
+    int getBufferTarget() const { return bufferTarget.load(std::memory_order_relaxed); }
+
+    /** @brief Game side: queues an event. @return false if the queue was full. */
+    bool playEvent(const pixelroot32::audio::AudioEvent& event, uint8_t priority = 0) {
+        AudioCommand command;
+        command.type = AudioCommand::Type::PLAY_EVENT;
+        command.priority = priority;
+        command.event = event;
+        return send(command);
+    }
+
+    /** @brief Game side: silences every voice. @return false if the queue was full. */
+    bool stopAll() {
+        AudioCommand command;
+        command.type = AudioCommand::Type::STOP_ALL;
+        return send(command);
+    }
+
+    /**
+     * @brief Backend side: copies @p frames rendered samples to @p out.
+     *
+     * Frames the task has not rendered yet are written as silence.
+     * @return Frames that came from the task.
+     */
+    int read(int16_t* out, int frames) {
+        const unsigned long start = nowMicros();
+        const int available = output.size();
+        if (available < minBuffered.load(std::memory_order_relaxed)) {
+            minBuffered.store(available, std::memory_order_relaxed);
+        }
+
+        const int got = output.read(out, frames);
+        for (int i = got; i < frames; ++i) out[i] = 0;
+        if (got < frames) underrunFrames.fetch_add(static_cast<unsigned long>(frames - got), std::memory_order_relaxed);
+        readFrames.fetch_add(static_cast<uint32_t>(got), std::memory_order_release);
+
+        const unsigned long elapsed = nowMicros() - start;
+        if (elapsed > worstReadMicros.load(std::memory_order_relaxed)) {
+            worstReadMicros.store(elapsed, std::memory_order_relaxed);
+        }
+        return got;
+    }
+
+    /** @brief Snapshot of both sides' counters. */
+    AudioTaskStats getStats() const {
+        AudioTaskStats stats;
+        stats.commandsSent = commandsSent;
+        stats.commandsDropped = commandsDropped;
+        stats.maxQueued = maxQueued;
+        stats.blocks = blocks.load(std::memory_order_relaxed);
+        stats.worstBlockMicros = worstBlockMicros.load(std::memory_order_relaxed);
+        stats.underrunFrames = underrunFrames.load(std::memory_order_relaxed);
+        stats.bufferedFrames = output.size();
+        const int low = minBuffered.load(std::memory_order_relaxed);
+        stats.minBufferedFrames = low <= BufferFrames ? low : stats.bufferedFrames;
+        stats.bufferTarget = getBufferTarget();
+        stats.worstReadMicros = worstReadMicros.load(std::memory_order_relaxed);
+        stats.latencyEvents = latencyEvents.load(std::memory_order_relaxed);
+        stats.totalLatencyFrames = totalLatencyFrames.load(std::memory_order_relaxed);
+        stats.worstLatencyFrames = worstLatencyFrames.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    /** @brief Clears the counters; call from the game side. */
+    void resetStats() {
+        commandsSent = 0;
+        commandsDropped = 0;
+        maxQueued = 0;
+        blocks.store(0, std::memory_order_relaxed);
+        worstBlockMicros.store(0, std::memory_order_relaxed);
+        underrunFrames.store(0, std::memory_order_relaxed);
+        minBuffered.store(BufferFrames + 1, std::memory_order_relaxed);
+        worstReadMicros.store(0, std::memory_order_relaxed);
+        latencyEvents.store(0, std::memory_order_relaxed);
+        totalLatencyFrames.store(0, std::memory_order_relaxed);
+        worstLatencyFrames.store(0, std::memory_order_relaxed);
+    }
+
+    /** @brief Core the task was pinned to, or -1 on native builds. */
+    static constexpr int getCore() {
+#ifdef PLATFORM_NATIVE
+        return -1;
+#else
+        return 0;
+#endif
+    }
+
+    int getSampleRate() const { return mixer.getSampleRate(); }
+
+private:
+    bool send(AudioCommand& command) {
+        command.sentAtFrame = readFrames.load(std::memory_order_acquire);
+        if (!commands.push(command)) {
+            ++commandsDropped;
+            return false;
+        }
+        ++commandsSent;
+        const int queued = commands.size();
+        if (queued > maxQueued) maxQueued = queued;
+        return true;
+    }
+
+#ifndef PLATFORM_NATIVE
+    static void taskEntry(void* self) {
+        static_cast<AudioTask*>(self)->run();
+        static_cast<AudioTask*>(self)->finished.store(true);
+        vTaskDelete(nullptr);
+    }
+#endif
+
+    void run() {
+        const unsigned long idleMicros = mixer.getBlockBudgetMicros() / 2;
+        int16_t block[BlockFrames];
+
+        while (running.load()) {
+            AudioCommand command;
+            while (commands.pop(command)) {
+                if (command.type == AudioCommand::Type::STOP_ALL) {
+                    mixer.stopAll();
+                } else {
+                    mixer.play(command.event, command.priority);
+                    recordLatency(renderedFrames - command.sentAtFrame);
+                }
+            }
+
+            const int target = bufferTarget.load(std::memory_order_relaxed);
+            while (output.size() + BlockFrames <= target) {
+                mixer.render(block, BlockFrames);
+                output.write(block, BlockFrames);
+                renderedFrames += BlockFrames;
+                blocks.fetch_add(1, std::memory_order_relaxed);
+                const unsigned long elapsed = mixer.getStats().lastBlockMicros;
+                if (elapsed > worstBlockMicros.load(std::memory_order_relaxed)) {
+                    worstBlockMicros.store(elapsed, std::memory_order_relaxed);
+                }
+            }
+            primed.store(true);
+
+#ifdef PLATFORM_NATIVE
+            std::this_thread::sleep_for(std::chrono::microseconds(idleMicros));
+#else
+            // One tick (1 ms by default) is the shortest FreeRTOS sleep.
+            const TickType_t ticks = pdMS_TO_TICKS(idleMicros / 1000UL);
+            vTaskDelay(ticks > 0 ? ticks : 1);
+#endif
+        }
+    }
+
+    // Written by the task only, so one atomic per counter is enough.
+    void recordLatency(uint32_t frames) {
+        latencyEvents.fetch_add(1, std::memory_order_relaxed);
+        totalLatencyFrames.fetch_add(frames, std::memory_order_relaxed);
+        if (frames > worstLatencyFrames.load(std::memory_order_relaxed)) {
+            worstLatencyFrames.store(frames, std::memory_order_relaxed);
+        }
+    }
+
+    // Touched only by the audio task once it is running.
+    FixedMixer<MaxVoices, BlockFrames> mixer;
+    uint32_t renderedFrames = 0;  // Frames written to the output ring; wraps with readFrames
+
+    SpscRing<AudioCommand, QueueSize> commands;  // Game -> task
+    SpscRing<int16_t, BufferFrames> output;      // Task -> backend
+
+    // Game side.
+    unsigned long commandsSent = 0;
+    unsigned long commandsDropped = 0;
+    int maxQueued = 0;
+
+    // Written by the task or the backend, read by the game.
+    std::atomic<unsigned long> blocks{0};
+    std::atomic<unsigned long> worstBlockMicros{0};
+    std::atomic<unsigned long> underrunFrames{0};
+    std::atomic<int> minBuffered{BufferFrames + 1};
+    std::atomic<unsigned long> worstReadMicros{0};
+    std::atomic<unsigned long> latencyEvents{0};
+    std::atomic<unsigned long> totalLatencyFrames{0};
+    std::atomic<uint32_t> worstLatencyFrames{0};
+    std::atomic<uint32_t> readFrames{0};  // Frames read() took from the ring
+    std::atomic<int> bufferTarget{BufferFrames};
+
+    std::atomic<bool> running{false};
+    std::atomic<bool> primed{false};
+#ifdef PLATFORM_NATIVE
+    std::thread worker;
+#else
+    std::atomic<bool> finished{true};
+    TaskHandle_t handle = nullptr;
+#endif
+};
+
+} // namespace common
@@ -0,0 +1,13 @@
+#pragma once
+#include <chrono>
+
+namespace common {
+
+// Monotonic microsecond clock that works on both ESP32 and native builds.
+inline unsigned long nowMicros() {
+    using namespace std::chrono;
+    return static_cast<unsigned long>(
+        duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count());
+}
+
+}
@@ -0,0 +1,181 @@
+#pragma once
+#include "BenchTimer.h"
+#include <cmath>
+#include <cstdint>
+
+namespace common {
+
+/** @brief Time spent in one effect, in microseconds. */
+struct EffectStats {
+    unsigned long blocks = 0;
+    unsigned long totalMicros = 0;
+    unsigned long worstMicros = 0;
+
+    unsigned long getAverageMicros() const { return blocks ? totalMicros / blocks : 0; }
+};
+
+/**
+ * @brief Post-mix effects for a mono int16 stream: low-pass, echo, bitcrush.
+ *
+ * process() runs the enabled effects over a block in place, in that order,
+ * each as its own integer loop over the block:
+ * - Low-pass: one-pole filter, y += (x - y) * a, with the coefficient in
+ *   Q15 and the state kept with 8 extra fraction bits.
+ * - Echo: feedback delay line on an EchoFrames ring of int16, with Q15
+ *   feedback and wet levels.
+ * - Bitcrush: drops low bits and holds every Nth sample.
+ *
+ * Each effect's time per block is kept in getStats(), so the bus can be
+ * checked against the block's real-time budget. The only float work is in
+ * the setters.
+ */
+template <int EchoFrames = 2048>
+class EffectsBus {
+public:
+    enum Effect {
+        LOW_PASS,
+        ECHO,
+        BITCRUSH,
+        EFFECT_COUNT
+    };
+
+    explicit EffectsBus(int sampleRate = 22050) : sampleRate(sampleRate) { reset(); }
+
+    /** @brief Clears filter state and the echo line; settings are kept. */
+    void reset() {
+        lowPassState = 0;
+        for (int i = 0; i < EchoFrames; ++i) echoLine[i] = 0;
+        echoPos = 0;
+        crushHold = 0;
+        crushCount = 0;
+    }
+
+    /** @brief Low-pass cutoff in Hz; 0 turns the filter off. */
+    void setLowPass(float cutoffHz) {
+        enabled[LOW_PASS] = cutoffHz > 0.0f;
+        if (!enabled[LOW_PASS]) return;
+        const float a = 1.0f - std::exp(-2.0f * 3.14159265f * cutoffHz / static_cast<float>(sampleRate));
+        lowPassCoeff = static_cast<int32_t>(a * 32767.0f);
+    }
+
+    /**
+     * @brief Echo delay (clamped to EchoFrames), feedback and wet level, 0..1.
+     * A delay of 0 turns the echo off.
+     */
+    void setEcho(float delayMs, float feedback, float wet) {
+        int frames = static_cast<int>(delayMs * static_cast<float>(sampleRate) / 1000.0f);
+        frames = frames > EchoFrames ? EchoFrames : frames;
+        enabled[ECHO] = frames > 0;
+        echoFrames = frames > 0 ? frames : 1;
+        echoFeedback = toQ15(feedback);
+        echoWet = toQ15(wet);
+        if (echoPos >= echoFrames) echoPos = 0;
+    }
+
+    /** @brief Keeps the top @p bits bits and holds each sample @p hold times; 16 and 1 turn it off. */
+    void setBitcrush(int bits, int hold) {
+        bits = bits < 1 ? 1 : (bits > 16 ? 16 : bits);
+        crushMask = static_cast<int32_t>(~((1u << (16 - bits)) - 1u));
+        crushHoldFrames = hold < 1 ? 1 : hold;
+        enabled[BITCRUSH] = bits < 16 || crushHoldFrames > 1;
+    }
+
+    void setEnabled(Effect effect, bool on) { enabled[effect] = on; }
+    bool isEnabled(Effect effect) const { return enabled[effect]; }
+
+    /** @brief Runs the enabled effects over @p frames samples in place. */
+    void process(int16_t* samples, int frames) {
+        if (enabled[LOW_PASS]) timed(LOW_PASS, samples, frames, &EffectsBus::lowPass);
+        if (enabled[ECHO]) timed(ECHO, samples, frames, &EffectsBus::echo);
+        if (enabled[BITCRUSH]) timed(BITCRUSH, samples, frames, &EffectsBus::bitcrush);
+    }
+
+    const EffectStats& getStats(Effect effect) const { return stats[effect]; }
+
+    void resetStats() {
+        for (EffectStats& effect : stats) effect = EffectStats{};
+    }
+
+    /** @brief Echo line memory, in bytes. */
+    static constexpr int getEchoBytes() { return EchoFrames * static_cast<int>(sizeof(int16_t)); }
+
+private:
+    static int32_t toQ15(float value) {
+        value = value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+        return static_cast<int32_t>(value * 32767.0f);
+    }
+
+    static int16_t clamp16(int32_t s) {
+        return static_cast<int16_t>(s > 32767 ? 32767 : (s < -32768 ? -32768 : s));
+    }
+
+    void timed(Effect effect, int16_t* samples, int frames, void (EffectsBus::*kernel)(int16_t*, int)) {
+        const unsigned long start = nowMicros();
+        (this->*kernel)(samples, frames);
+        const unsigned long elapsed = nowMicros() - start;
+        EffectStats& effectStats = stats[effect];
+        ++effectStats.blocks;
+        effectStats.totalMicros += elapsed;
+        if (elapsed > effectStats.worstMicros) effectStats.worstMicros = elapsed;
+    }
+
+    void lowPass(int16_t* samples, int frames) {
+        int32_t y = lowPassState;  // Q8
+        const int32_t a = lowPassCoeff;
+        for (int i = 0; i < frames; ++i) {
+            const int32_t x = static_cast<int32_t>(samples[i]) * 256;
+            y += static_cast<int32_t>((static_cast<int64_t>(x - y) * a) >> 15);
+            samples[i] = static_cast<int16_t>(y >> 8);
+        }
+        lowPassState = y;
+    }
+
+    void echo(int16_t* samples, int frames) {
+        int pos = echoPos;
+        const int length = echoFrames;
+        const int32_t feedback = echoFeedback;
+        const int32_t wet = echoWet;
+        for (int i = 0; i < frames; ++i) {
+            const int32_t delayed = echoLine[pos];
+            const int32_t x = samples[i];
+            echoLine[pos] = clamp16(x + ((delayed * feedback) >> 15));
+            samples[i] = clamp16(x + ((delayed * wet) >> 15));
+            if (++pos == length) pos = 0;
+        }
+        echoPos = pos;
+    }
+
+    void bitcrush(int16_t* samples, int frames) {
+        int32_t held = crushHold;
+        int count = crushCount;
+        const int32_t mask = crushMask;
+        const int hold = crushHoldFrames;
+        for (int i = 0; i < frames; ++i) {
+            if (count == 0) held = samples[i] & mask;
+            if (++count == hold) count = 0;
+            samples[i] = static_cast<int16_t>(held);
+        }
+        crushHold = held;
+        crushCount = count;
+    }
+
+    int sampleRate;
+    bool enabled[EFFECT_COUNT] = {};
+    EffectStats stats[EFFECT_COUNT];
+
+    int32_t lowPassCoeff = 32767;
+    int32_t lowPassState = 0;
+
+    int16_t echoLine[EchoFrames];
+    int echoFrames = 1;
+    int echoPos = 0;
+    int32_t echoFeedback = 0;
+    int32_t echoWet = 0;
+
+    int32_t crushMask = -1;
+    int crushHoldFrames = 1;
+    int32_t crushHold = 0;
+    int crushCount = 0;
+};
+
+} // namespace common
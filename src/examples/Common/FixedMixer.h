@@ -0,0 +1,352 @@
+#pragma once
+#include "audio/AudioTypes.h"
+#include "BenchTimer.h"
+#include <cstdint>
+
+namespace common {
+
+/** @brief Mixer timing, in microseconds per rendered block, and voice allocation counters. */
+struct MixerStats {
+    unsigned long blocks = 0;
+    unsigned long lastBlockMicros = 0;
+    unsigned long worstBlockMicros = 0;
+    unsigned long totalMicros = 0;
+
+    unsigned long started = 0;       // Events that got a voice
+    unsigned long deduplicated = 0;  // Repeats of an event not yet rendered
+    unsigned long stolen = 0;        // Voices cut short for a new event
+    unsigned long dropped = 0;       // Events that found no voice
+    int peakVoices = 0;
+
+    unsigned long getAverageMicros() const { return blocks ? totalMicros / blocks : 0; }
+};
+
+/** @brief Which voice FixedMixer takes over when it is at its polyphony limit. */
+enum class StealMode : uint8_t {
+    NONE,     // Drop the new event
+    OLDEST,   // Voice that has played longest
+    QUIETEST  // Voice with the lowest volume
+};
+
+/**
+ * @brief Integer block mixer for AudioEvent voices (pulse, triangle, noise).
+ *
+ * All per-sample work is integer: each voice is a 32-bit phase accumulator
+ * whose step is computed once, in floating point, when the event starts.
+ * Pulse compares the phase against a duty threshold, triangle folds the top
+ * 16 phase bits, and noise clocks a 15-bit LFSR (the NES noise channel's)
+ * every time the phase wraps. Volumes become integer amplitudes with room
+ * for four full-scale voices before the mix clips.
+ *
+ * render() works in blocks of BlockFrames samples: every voice adds its whole
+ * block into a 32-bit accumulator in one tight loop, with the waveform switch
+ * hoisted out of the loop, and the block is then clamped to int16 once. Each
+ * block's render time is recorded in getStats(), to compare against the
+ * block's real-time budget (getBlockBudgetMicros()).
+ *
+ * Voice allocation bounds the mixing cost when events arrive in bursts. At
+ * most getPolyphony() voices play at once. An event identical to one started
+ * since the last render() (the same frame, for a caller that renders once
+ * per frame) is merged into it. When every voice is busy, the new event
+ * steals a voice of equal or lower priority, picked by the StealMode,
+ * lowest priority first; otherwise it is dropped. getStats() counts each
+ * outcome.
+ *
+ * playSample() starts a voice that plays back pre-rendered 8-bit PCM (see
+ * SfxCache) instead of synthesizing; it goes through the same allocation.
+ */
+template <int MaxVoices, int BlockFrames = 128>
+class FixedMixer {
+public:
+    static_assert(MaxVoices > 0 && BlockFrames > 0, "FixedMixer needs voices and a block size");
+
+    // Per-voice full scale: four voices at volume 1.0 fill the int16 range.
+    static constexpr int32_t VoiceFullScale = 32767 / 4;
+
+    explicit FixedMixer(int sampleRate = 22050) : sampleRate(sampleRate), polyphony(MaxVoices) { stopAll(); }
+
+    void setSampleRate(int rate) {
+        sampleRate = rate;
+        stopAll();
+    }
+
+    int getSampleRate() const { return sampleRate; }
+
+    /** @brief Caps the voices playing at once (1..MaxVoices). */
+    void setPolyphony(int limit) {
+        polyphony = limit < 1 ? 1 : (limit > MaxVoices ? MaxVoices : limit);
+    }
+
+    int getPolyphony() const { return polyphony; }
+
+    void setStealMode(StealMode mode) { stealMode = mode; }
+    StealMode getStealMode() const { return stealMode; }
+
+    /** @brief Merges repeats of an event within one render() call (on by default). */
+    void setDeduplicate(bool enabled) { deduplicate = enabled; }
+
+    /**
+     * @brief Starts an event, merging, stealing or dropping as configured.
+     * @param priority Higher values may steal voices from lower ones.
+     * @return false if the event was dropped.
+     */
+    bool play(const pixelroot32::audio::AudioEvent& event, uint8_t priority = 0) {
+        Voice* voice = nullptr;
+        if (!allocate(event, priority, voice)) return false;
+        if (voice) start(*voice, event, priority);
+        return true;
+    }
+
+    /**
+     * @brief Plays @p frames samples of 8-bit PCM at the event's volume.
+     *
+     * @p event is the event the samples were rendered from; it is used for
+     * deduplication. The data must stay valid while the voice plays.
+     * @return false if the event was dropped.
+     */
+    bool playSample(const int8_t* pcm, uint32_t frames, const pixelroot32::audio::AudioEvent& event,
+                    uint8_t priority = 0) {
+        Voice* voice = nullptr;
+        if (!allocate(event, priority, voice)) return false;
+        if (voice) {
+            start(*voice, event, priority);
+            voice->pcm = pcm;
+            voice->remaining = frames;
+            voice->active = pcm && frames > 0;
+        }
+        return true;
+    }
+
+    void stopAll() {
+        for (Voice& voice : voices) voice.active = false;
+    }
+
+    int getActiveVoices() const {
+        int count = 0;
+        for (const Voice& voice : voices) {
+            if (voice.active) ++count;
+        }
+        return count;
+    }
+
+    /** @brief Renders @p frames mono samples, block by block. */
+    void render(int16_t* out, int frames) {
+        while (frames > 0) {
+            const int count = frames < BlockFrames ? frames : BlockFrames;
+            const unsigned long start = nowMicros();
+            renderBlock(out, count);
+            const unsigned long elapsed = nowMicros() - start;
+
+            ++stats.blocks;
+            stats.lastBlockMicros = elapsed;
+            stats.totalMicros += elapsed;
+            if (elapsed > stats.worstBlockMicros) stats.worstBlockMicros = elapsed;
+
+            out += count;
+            frames -= count;
+        }
+    }
+
+    const MixerStats& getStats() const { return stats; }
+    void resetStats() { stats = MixerStats{}; }
+
+    /** @brief Real-time length of one block: the most it may take to render. */
+    unsigned long getBlockBudgetMicros() const {
+        return static_cast<unsigned long>(BlockFrames) * 1000000UL / static_cast<unsigned long>(sampleRate);
+    }
+
+private:
+    struct Voice {
+        pixelroot32::audio::WaveType type = pixelroot32::audio::WaveType::PULSE;
+        uint32_t phase = 0;
+        uint32_t step = 0;
+        uint32_t dutyThreshold = 0;
+        int32_t amplitude = 0;
+        uint32_t remaining = 0;  // Samples left
+        uint32_t age = 0;        // Samples played
+        uint16_t lfsr = 1;
+        uint8_t priority = 0;
+        bool active = false;
+        const int8_t* pcm = nullptr;              // Sample playback instead of synthesis
+        pixelroot32::audio::AudioEvent event{};  // As requested, for deduplication
+    };
+
+    static bool sameEvent(const pixelroot32::audio::AudioEvent& a, const pixelroot32::audio::AudioEvent& b) {
+        return a.type == b.type && a.frequency == b.frequency && a.duration == b.duration &&
+               a.volume == b.volume && a.duty == b.duty;
+    }
+
+    // An active voice playing the same event that has not been rendered yet.
+    Voice* findPending(const pixelroot32::audio::AudioEvent& event) {
+        for (Voice& voice : voices) {
+            if (voice.active && voice.age == 0 && sameEvent(voice.event, event)) return &voice;
+        }
+        return nullptr;
+    }
+
+    Voice* findVictim(uint8_t priority) {
+        if (stealMode == StealMode::NONE) return nullptr;
+        Voice* victim = nullptr;
+        for (Voice& voice : voices) {
+            if (!voice.active || voice.priority > priority) continue;
+            if (!victim || voice.priority < victim->priority) {
+                victim = &voice;
+            } else if (voice.priority == victim->priority) {
+                const bool better = stealMode == StealMode::OLDEST ? voice.age > victim->age
+                                                                   : voice.amplitude < victim->amplitude;
+                if (better) victim = &voice;
+            }
+        }
+        return victim;
+    }
+
+    // Picks the voice for a new event: false if it is dropped, true with
+    // voice == nullptr if it merged into a pending one.
+    bool allocate(const pixelroot32::audio::AudioEvent& event, uint8_t priority, Voice*& voice) {
+        voice = nullptr;
+        if (deduplicate && findPending(event)) {
+            ++stats.deduplicated;
+            return true;
+        }
+
+        Voice* target = nullptr;
+        int active = 0;
+        for (Voice& candidate : voices) {
+            if (candidate.active) {
+                ++active;
+            } else if (!target) {
+                target = &candidate;
+            }
+        }
+
+        if (active >= polyphony) {
+            target = findVictim(priority);
+            if (!target) {
+                ++stats.dropped;
+                return false;
+            }
+            ++stats.stolen;
+            --active;
+        }
+
+        voice = target;
+        ++stats.started;
+        if (active + 1 > stats.peakVoices) stats.peakVoices = active + 1;
+        return true;
+    }
+
+    void start(Voice& voice, const pixelroot32::audio::AudioEvent& event, uint8_t priority) {
+        float volume = event.volume < 0.0f ? 0.0f : (event.volume > 1.0f ? 1.0f : event.volume);
+        float duty = event.duty <= 0.0f ? 0.5f : (event.duty > 1.0f ? 1.0f : event.duty);
+        voice.type = event.type;
+        voice.phase = 0;
+        // Phase step as a fraction of 2^32, kept below Nyquist so it cannot overflow.
+        float cycles = event.frequency / static_cast<float>(sampleRate);
+        cycles = cycles < 0.0f ? 0.0f : (cycles > 0.5f ? 0.5f : cycles);
+        voice.step = static_cast<uint32_t>(cycles * 4294967296.0f);
+        voice.dutyThreshold = static_cast<uint32_t>(duty * 4294967295.0f);
+        voice.amplitude = static_cast<int32_t>(volume * VoiceFullScale);
+        voice.remaining = static_cast<uint32_t>(event.duration * static_cast<float>(sampleRate));
+        voice.age = 0;
+        voice.lfsr = 1;
+        voice.priority = priority;
+        voice.pcm = nullptr;
+        voice.event = event;
+        voice.active = voice.remaining > 0;
+    }
+
+    void renderBlock(int16_t* out, int frames) {
+        for (int i = 0; i < frames; ++i) mix[i] = 0;
+
+        for (Voice& voice : voices) {
+            if (!voice.active) continue;
+            const int count = voice.remaining < static_cast<uint32_t>(frames) ? static_cast<int>(voice.remaining) : frames;
+            if (voice.pcm) {
+                addSample(voice, count);
+            } else {
+                switch (voice.type) {
+                    case pixelroot32::audio::WaveType::PULSE:
+                        addPulse(voice, count);
+                        break;
+                    case pixelroot32::audio::WaveType::TRIANGLE:
+                        addTriangle(voice, count);
+                        break;
+                    default:
+                        addNoise(voice, count);
+                        break;
+                }
+            }
+            voice.remaining -= static_cast<uint32_t>(count);
+            voice.age += static_cast<uint32_t>(count);
+            if (voice.remaining == 0) voice.active = false;
+        }
+
+        for (int i = 0; i < frames; ++i) {
+            const int32_t s = mix[i];
+            out[i] = static_cast<int16_t>(s > 32767 ? 32767 : (s < -32768 ? -32768 : s));
+        }
+    }
+
+    void addPulse(Voice& voice, int count) {
+        uint32_t phase = voice.phase;
+        const uint32_t step = voice.step;
+        const uint32_t threshold = voice.dutyThreshold;
+        const int32_t amplitude = voice.amplitude;
+        for (int i = 0; i < count; ++i) {
+            mix[i] += phase < threshold ? amplitude : -amplitude;
+            phase += step;
+        }
+        voice.phase = phase;
+    }
+
+    void addTriangle(Voice& voice, int count) {
+        uint32_t phase = voice.phase;
+        const uint32_t step = voice.step;
+        const int32_t amplitude = voice.amplitude;
+        for (int i = 0; i < count; ++i) {
+            // Top 16 bits rise to 32767 over the first half and fall back over the second.
+            const int32_t p = static_cast<int32_t>(phase >> 16);
+            const int32_t tri = p < 32768 ? p * 2 - 32767 : 98303 - p * 2;
+            mix[i] += (tri * amplitude) >> 15;
+            phase += step;
+        }
+        voice.phase = phase;
+    }
+
+    void addSample(const Voice& voice, int count) {
+        const int8_t* pcm = voice.pcm + voice.age;
+        const int32_t amplitude = voice.amplitude;
+        for (int i = 0; i < count; ++i) {
+            // Full-scale PCM is +-127, so this lands on the synthesized voice's level.
+            mix[i] += (pcm[i] * amplitude) >> 7;
+        }
+    }
+
+    void addNoise(Voice& voice, int count) {
+        uint32_t phase = voice.phase;
+        const uint32_t step = voice.step;
+        uint16_t lfsr = voice.lfsr;
+        const int32_t amplitude = voice.amplitude;
+        for (int i = 0; i < count; ++i) {
+            const uint32_t next = phase + step;
+            if (next < phase) {
+                const uint16_t feedback = static_cast<uint16_t>((lfsr ^ (lfsr >> 1)) & 1u);
+                lfsr = static_cast<uint16_t>((lfsr >> 1) | (feedback << 14));
+            }
+            phase = next;
+            mix[i] += (lfsr & 1u) ? amplitude : -amplitude;
+        }
+        voice.phase = phase;
+        voice.lfsr = lfsr;
+    }
+
+    Voice voices[MaxVoices];
+    int32_t mix[BlockFrames] = {};
+    MixerStats stats;
+    int sampleRate;
+    int polyphony;
+    StealMode stealMode = StealMode::OLDEST;
+    bool deduplicate = true;
+};
+
+} // namespace common
@@ -0,0 +1,204 @@
+#pragma once
+#include "graphics/Renderer.h"
+#include "RowUnpack.h"
+#include <cstdint>
+
+#ifdef PIXELROOT32_ENABLE_2BPP_SPRITES
+
+namespace common {
+
+/**
+ * @brief A MultiSprite flattened into one indexed 2bpp (or 4bpp) bitmap.
+ *
+ * drawMultiSprite() walks the bitmap once per layer and tests a bit per layer
+ * per pixel. Flattening resolves the layers once, so later layers win exactly
+ * as they do when drawn in order. Each distinct layer color becomes a palette
+ * entry, and index 0 stays transparent. The result is drawn with the
+ * single-pass indexed drawSprite() overload.
+ *
+ * Up to 3 colors fit 2bpp. Up to 15 fit 4bpp when PIXELROOT32_ENABLE_4BPP_SPRITES
+ * is enabled. Rows are padded to whole 16-bit words, as the sprite compiler
+ * emits them. The padding columns are transparent.
+ *
+ * countMismatches() is the validation mode: it re-resolves every pixel from
+ * the layers and compares it with the flattened bitmap.
+ */
+template <int MaxWidth, int MaxHeight>
+class FlatSprite {
+public:
+    static_assert(MaxWidth > 0 && MaxWidth <= 16, "FlatSprite layers are 1bpp uint16_t rows");
+    static_assert(MaxHeight > 0 && MaxHeight <= 255, "FlatSprite height must fit in a sprite");
+
+    static constexpr int MaxLayers = 15;
+
+    FlatSprite() : width(0), height(0), paddedWidth(0), bpp(0), paletteSize(0) {}
+
+    /** @brief Flattens a MultiSprite. Returns false if it does not fit or has too many colors. */
+    bool build(const pixelroot32::graphics::MultiSprite& source) {
+        if (source.layerCount > MaxLayers) return invalidate();
+        const uint16_t* rows[MaxLayers];
+        pixelroot32::graphics::Color colors[MaxLayers];
+        for (int i = 0; i < source.layerCount; ++i) {
+            rows[i] = source.layers[i].data;
+            colors[i] = source.layers[i].color;
+        }
+        return build(rows, colors, source.layerCount, source.width, source.height);
+    }
+
+    /**
+     * @brief Flattens raw 1bpp layers (bit 0 = leftmost pixel), drawn in order.
+     * @return false if the size exceeds the storage or the colors exceed the available depth.
+     */
+    bool build(const uint16_t* const* layerRows, const pixelroot32::graphics::Color* layerColors,
+               int layerCount, int srcWidth, int srcHeight) {
+        if (layerCount <= 0 || layerCount > MaxLayers ||
+            srcWidth <= 0 || srcWidth > MaxWidth || srcHeight <= 0 || srcHeight > MaxHeight) {
+            return invalidate();
+        }
+
+        // Map each layer to a palette index, sharing entries between equal colors.
+        uint8_t layerIndex[MaxLayers];
+        palette[0] = pixelroot32::graphics::Color::Transparent;
+        paletteSize = 1;
+        for (int i = 0; i < layerCount; ++i) {
+            int found = -1;
+            for (int p = 1; p < paletteSize; ++p) {
+                if (palette[p] == layerColors[i]) {
+                    found = p;
+                    break;
+                }
+            }
+            if (found < 0) {
+                found = paletteSize;
+                palette[paletteSize++] = layerColors[i];
+            }
+            layerIndex[i] = static_cast<uint8_t>(found);
+        }
+
+        if (paletteSize <= 4) {
+            bpp = 2;
+        }
+#ifdef PIXELROOT32_ENABLE_4BPP_SPRITES
+        else if (paletteSize <= 16) {
+            bpp = 4;
+        }
+#endif
+        else {
+            return invalidate();
+        }
+
+        width = srcWidth;
+        height = srcHeight;
+        const int pixelsPerWord = 16 / bpp;
+        paddedWidth = ((width + pixelsPerWord - 1) / pixelsPerWord) * pixelsPerWord;
+
+        const int stride = rowBytes();
+        for (int i = 0; i < stride * height; ++i) data[i] = 0;
+
+        for (int y = 0; y < height; ++y) {
+            uint8_t* row = data + y * stride;
+            for (int x = 0; x < width; ++x) {
+                uint8_t index = 0;
+                for (int l = 0; l < layerCount; ++l) {
+                    if (layerRows[l][y] & (1u << x)) index = layerIndex[l];
+                }
+                const int bit = x * bpp;
+                row[bit >> 3] |= static_cast<uint8_t>(index << (bit & 7));
+            }
+        }
+
+        sprite2bpp = { data, palette, static_cast<uint8_t>(paddedWidth), static_cast<uint8_t>(height), paletteSize };
+#ifdef PIXELROOT32_ENABLE_4BPP_SPRITES
+        sprite4bpp = { data, palette, static_cast<uint8_t>(paddedWidth), static_cast<uint8_t>(height), paletteSize };
+#endif
+        return true;
+    }
+
+    bool isValid() const { return bpp != 0; }
+    int getBpp() const { return bpp; }
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    int getPaletteSize() const { return paletteSize; }
+
+    /** @brief Palette index at (x, y); 0 means transparent. */
+    uint8_t getIndex(int x, int y) const {
+        const int bit = x * bpp;
+        const uint8_t mask = static_cast<uint8_t>((1u << bpp) - 1);
+        return static_cast<uint8_t>((data[y * rowBytes() + (bit >> 3)] >> (bit & 7)) & mask);
+    }
+
+    /**
+     * @brief Draws the flattened bitmap in a single indexed pass.
+     * Flipping mirrors the padded row, so pass pre-mirrored layers instead when
+     * the width is not a multiple of the word size and flipX matters.
+     */
+    void draw(pixelroot32::graphics::Renderer& renderer, int x, int y, bool flipX = false) const {
+        if (bpp == 2) {
+            renderer.drawSprite(sprite2bpp, x, y, flipX);
+        }
+#ifdef PIXELROOT32_ENABLE_4BPP_SPRITES
+        else if (bpp == 4) {
+            renderer.drawSprite(sprite4bpp, x, y, flipX);
+        }
+#endif
+    }
+
+    /**
+     * @brief Validation mode: resolves every pixel of the layered source again and
+     *        compares its color with the flattened bitmap.
+     * @return Number of differing pixels (0 = pixel-identical), or -1 if not built.
+     */
+    int countMismatches(const pixelroot32::graphics::MultiSprite& source) const {
+        if (!isValid() || source.width != width || source.height != height) return -1;
+
+        int mismatches = 0;
+        uint8_t indices[MaxWidth];
+        for (int y = 0; y < height; ++y) {
+            unpackRow(data + y * rowBytes(), bpp, width, 0, width, false, indices);
+            for (int x = 0; x < width; ++x) {
+                bool opaque = false;
+                pixelroot32::graphics::Color expected = pixelroot32::graphics::Color::Transparent;
+                for (int l = 0; l < source.layerCount; ++l) {
+                    if (source.layers[l].data[y] & (1u << x)) {
+                        opaque = true;
+                        expected = source.layers[l].color;
+                    }
+                }
+
+                const uint8_t index = indices[x];
+                if (opaque != (index != 0) || (opaque && palette[index] != expected)) {
+                    ++mismatches;
+                }
+            }
+        }
+        return mismatches;
+    }
+
+private:
+    int rowBytes() const { return (paddedWidth * bpp) / 8; }
+
+    bool invalidate() {
+        bpp = 0;
+        width = height = paddedWidth = 0;
+        paletteSize = 0;
+        return false;
+    }
+
+    int width;
+    int height;
+    int paddedWidth;
+    int bpp;
+    uint8_t paletteSize;
+
+    // Worst case is 4bpp: two pixels per byte, rows padded to 16-bit words.
+    uint8_t data[((MaxWidth + 3) / 4) * 2 * MaxHeight] = {};
+    pixelroot32::graphics::Color palette[16] = {};
+    pixelroot32::graphics::Sprite2bpp sprite2bpp = {};
+#ifdef PIXELROOT32_ENABLE_4BPP_SPRITES
+    pixelroot32::graphics::Sprite4bpp sprite4bpp = {};
+#endif
+};
+
+} // namespace common
+
+#endif // PIXELROOT32_ENABLE_2BPP_SPRITES
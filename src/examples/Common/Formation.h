@@ -0,0 +1,226 @@
+#pragma once
+
+namespace common {
+
+/**
+ * @brief Lockstep group of members laid out on a Rows x Cols grid.
+ *
+ * Every member stores its offset relative to a single origin, so moving the
+ * whole group is one origin update no matter how many members it has.
+ * Aggregates that games query every step (live count, bounding box,
+ * bottom-most member per column) are cached and only refreshed when a member
+ * is killed, which costs O(Rows + Cols). Every query is O(1), except
+ * picking a random bottom-most member, which is O(Cols).
+ *
+ * Members are indexed row-major: index = row * Cols + col.
+ */
+template <int Rows, int Cols>
+class Formation {
+public:
+    static constexpr int MemberCount = Rows * Cols;
+    static_assert(Rows > 0 && Cols > 0, "Formation needs at least one member slot");
+
+    Formation() { reset(0.0f, 0.0f); }
+
+    /** @brief Empties the formation and places its origin. */
+    void reset(float x, float y) {
+        originX = x;
+        originY = y;
+        stepCount = 0;
+        liveCount = 0;
+        for (int i = 0; i < MemberCount; ++i) {
+            members[i] = Member{};
+        }
+        for (int c = 0; c < Cols; ++c) {
+            columns[c] = Span{};
+            bottomMost[c] = -1;
+        }
+        for (int r = 0; r < Rows; ++r) {
+            rows[r] = Span{};
+        }
+        boundsLeft = boundsRight = boundsTop = boundsBottom = 0.0f;
+    }
+
+    /**
+     * @brief Adds a live member at (row, col) with an offset from the origin.
+     * @return The member index, or -1 if the slot is out of range or taken.
+     */
+    int addMember(int row, int col, float offsetX, float offsetY, int width, int height) {
+        if (row < 0 || row >= Rows || col < 0 || col >= Cols) return -1;
+        const int index = row * Cols + col;
+        Member& m = members[index];
+        if (m.alive) return -1;
+
+        m.offsetX = offsetX;
+        m.offsetY = offsetY;
+        m.width = width;
+        m.height = height;
+        m.alive = true;
+        ++liveCount;
+
+        refreshColumn(col);
+        refreshRow(row);
+        refreshBounds();
+        return index;
+    }
+
+    /** @brief Marks a member as dead and refreshes the cached aggregates it touched. */
+    void kill(int index) {
+        if (index < 0 || index >= MemberCount || !members[index].alive) return;
+        members[index].alive = false;
+        --liveCount;
+
+        refreshColumn(index % Cols);
+        refreshRow(index / Cols);
+        refreshBounds();
+    }
+
+    /** @brief Moves every member at once by shifting the shared origin. */
+    void moveBy(float dx, float dy) {
+        originX += dx;
+        originY += dy;
+        ++stepCount;
+    }
+
+    bool isAlive(int index) const {
+        return index >= 0 && index < MemberCount && members[index].alive;
+    }
+
+    float getMemberX(int index) const { return originX + members[index].offsetX; }
+    float getMemberY(int index) const { return originY + members[index].offsetY; }
+    int getMemberWidth(int index) const { return members[index].width; }
+    int getMemberHeight(int index) const { return members[index].height; }
+
+    float getOriginX() const { return originX; }
+    float getOriginY() const { return originY; }
+
+    /** @brief Number of moveBy() calls since reset(); handy for step-synced animation. */
+    unsigned int getStepCount() const { return stepCount; }
+
+    int getLiveCount() const { return liveCount; }
+
+    // Absolute bounding box of the live members. Only meaningful while getLiveCount() > 0.
+    float getLeft() const { return originX + boundsLeft; }
+    float getRight() const { return originX + boundsRight; }
+    float getTop() const { return originY + boundsTop; }
+    float getBottom() const { return originY + boundsBottom; }
+
+    /** @brief Index of the lowest live member in a column, or -1 if the column is empty. */
+    int getBottomMost(int col) const {
+        return (col >= 0 && col < Cols) ? bottomMost[col] : -1;
+    }
+
+    /**
+     * @brief Picks a random column that still has live members and returns its bottom-most member.
+     * @param randomValue Any non-negative random number (e.g. std::rand()).
+     * @return Member index, or -1 if the formation is empty.
+     */
+    int pickBottomMost(int randomValue) const {
+        int liveColumns[Cols];
+        int count = 0;
+        for (int c = 0; c < Cols; ++c) {
+            if (bottomMost[c] >= 0) liveColumns[count++] = c;
+        }
+        if (count == 0) return -1;
+        return bottomMost[liveColumns[randomValue % count]];
+    }
+
+private:
+    struct Member {
+        float offsetX = 0.0f;
+        float offsetY = 0.0f;
+        int width = 0;
+        int height = 0;
+        bool alive = false;
+    };
+
+    // Extent of the live members of one column or row, relative to the origin.
+    struct Span {
+        bool any = false;
+        float minX = 0.0f;
+        float maxX = 0.0f;
+        float minY = 0.0f;
+        float maxY = 0.0f;
+    };
+
+    static void include(Span& span, const Member& m) {
+        const float right = m.offsetX + m.width;
+        const float bottom = m.offsetY + m.height;
+        if (!span.any) {
+            span.any = true;
+            span.minX = m.offsetX;
+            span.maxX = right;
+            span.minY = m.offsetY;
+            span.maxY = bottom;
+            return;
+        }
+        if (m.offsetX < span.minX) span.minX = m.offsetX;
+        if (right > span.maxX) span.maxX = right;
+        if (m.offsetY < span.minY) span.minY = m.offsetY;
+        if (bottom > span.maxY) span.maxY = bottom;
+    }
+
+    void refreshColumn(int col) {
+        Span span;
+        int lowest = -1;
+        float lowestY = 0.0f;
+        for (int r = 0; r < Rows; ++r) {
+            const int index = r * Cols + col;
+            const Member& m = members[index];
+            if (!m.alive) continue;
+            include(span, m);
+            if (lowest < 0 || m.offsetY >= lowestY) {
+                lowest = index;
+                lowestY = m.offsetY;
+            }
+        }
+        columns[col] = span;
+        bottomMost[col] = lowest;
+    }
+
+    void refreshRow(int row) {
+        Span span;
+        for (int c = 0; c < Cols; ++c) {
+            const Member& m = members[row * Cols + c];
+            if (m.alive) include(span, m);
+        }
+        rows[row] = span;
+    }
+
+    // Horizontal extent folds the column spans, vertical extent the row spans.
+    void refreshBounds() {
+        bool any = false;
+        for (int c = 0; c < Cols; ++c) {
+            const Span& s = columns[c];
+            if (!s.any) continue;
+            if (!any || s.minX < boundsLeft) boundsLeft = s.minX;
+            if (!any || s.maxX > boundsRight) boundsRight = s.maxX;
+            any = true;
+        }
+
+        any = false;
+        for (int r = 0; r < Rows; ++r) {
+            const Span& s = rows[r];
+            if (!s.any) continue;
+            if (!any || s.minY < boundsTop) boundsTop = s.minY;
+            if (!any || s.maxY > boundsBottom) boundsBottom = s.maxY;
+            any = true;
+        }
+    }
+
+    float originX = 0.0f;
+    float originY = 0.0f;
+    unsigned int stepCount = 0;
+    int liveCount = 0;
+
+    Member members[MemberCount];
+    Span columns[Cols];
+    Span rows[Rows];
+    int bottomMost[Cols];
+    float boundsLeft = 0.0f;
+    float boundsRight = 0.0f;
+    float boundsTop = 0.0f;
+    float boundsBottom = 0.0f;
+};
+
+} // namespace common
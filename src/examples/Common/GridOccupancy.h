@@ -0,0 +1,106 @@
+#pragma once
+#include <cstdint>
+#include <cstdlib>
+
+namespace common {
+
+/**
+ * @brief Occupancy index for a fixed-size tile grid.
+ *
+ * A bitset answers "is this cell taken?" and a dense list of the free cells
+ * (plus each cell's slot in that list) keeps occupy/release at O(1) through
+ * swap-remove. Picking a uniformly random free cell is a single lookup, so
+ * spawning food, items or enemies never has to rejection-sample the grid.
+ *
+ * Storage is static: roughly 4 bytes per cell plus one bit per cell.
+ */
+template <int Width, int Height>
+class GridOccupancy {
+public:
+    static constexpr int CellCount = Width * Height;
+    static_assert(Width > 0 && Height > 0, "GridOccupancy needs a non-empty grid");
+    static_assert(CellCount <= 0xFFFF, "GridOccupancy cell indices are 16-bit");
+
+    GridOccupancy() { clear(); }
+
+    /** @brief Marks every cell as free. */
+    void clear() {
+        for (int i = 0; i < BitBytes; ++i) bits[i] = 0;
+        for (int i = 0; i < CellCount; ++i) {
+            freeCells[i] = static_cast<uint16_t>(i);
+            freeSlot[i] = static_cast<uint16_t>(i);
+        }
+        freeCount = CellCount;
+    }
+
+    /** @brief True when (x, y) is inside the grid. */
+    static bool contains(int x, int y) {
+        return x >= 0 && x < Width && y >= 0 && y < Height;
+    }
+
+    /** @brief True when (x, y) is taken. Out-of-grid cells count as occupied. */
+    bool isOccupied(int x, int y) const {
+        if (!contains(x, y)) return true;
+        const int idx = toIndex(x, y);
+        return (bits[idx >> 3] & (1u << (idx & 7))) != 0;
+    }
+
+    /** @brief Marks (x, y) as taken. Returns false if outside the grid or already taken. */
+    bool occupy(int x, int y) {
+        if (isOccupied(x, y)) return false;
+        const int idx = toIndex(x, y);
+        bits[idx >> 3] |= static_cast<uint8_t>(1u << (idx & 7));
+
+        // Swap-remove: move the last free cell into the vacated slot.
+        const uint16_t slot = freeSlot[idx];
+        const uint16_t last = freeCells[--freeCount];
+        freeCells[slot] = last;
+        freeSlot[last] = slot;
+        return true;
+    }
+
+    /** @brief Marks (x, y) as free again. Returns false if outside the grid or already free. */
+    bool release(int x, int y) {
+        if (!contains(x, y) || !isOccupied(x, y)) return false;
+        const int idx = toIndex(x, y);
+        bits[idx >> 3] &= static_cast<uint8_t>(~(1u << (idx & 7)));
+
+        freeCells[freeCount] = static_cast<uint16_t>(idx);
+        freeSlot[idx] = static_cast<uint16_t>(freeCount);
+        ++freeCount;
+        return true;
+    }
+
+    /** @brief Marks a whole row as taken (e.g. HUD rows or walls). */
+    void occupyRow(int y) {
+        for (int x = 0; x < Width; ++x) occupy(x, y);
+    }
+
+    int getFreeCount() const { return freeCount; }
+    int getOccupiedCount() const { return CellCount - freeCount; }
+    bool isFull() const { return freeCount == 0; }
+
+    /**
+     * @brief Picks a uniformly random free cell in O(1).
+     * @return false when the grid is full (outputs are left untouched).
+     */
+    bool pickRandomFree(int& outX, int& outY) const {
+        if (freeCount == 0) return false;
+        const int idx = freeCells[std::rand() % freeCount];
+        outX = idx % Width;
+        outY = idx / Width;
+        return true;
+    }
+
+private:
+    static constexpr int BitBytes = (CellCount + 7) / 8;
+
+    static int toIndex(int x, int y) { return x + y * Width; }
+
+    uint8_t bits[BitBytes];
+    uint16_t freeCells[CellCount];  // Dense list of free cell indices
+    uint16_t freeSlot[CellCount];   // Position of each free cell in freeCells
+    int freeCount;
+};
+
+} // namespace common
@@ -0,0 +1,101 @@
+#pragma once
+#include "PaletteLUT.h"
+#include <cstdint>
+#include <cstring>
+
+namespace common {
+
+/**
+ * @brief Framebuffer of 8-bit palette indices, converted to RGB565 at present.
+ *
+ * Every draw writes one byte per pixel instead of two, so a 240x240 frame is
+ * 57.6 KB instead of 115.2 KB, and clears, fills and row copies move half
+ * the memory. Colors are resolved only in present(), which converts
+ * StripRows lines at a time through a PaletteLUT frame table into a small
+ * RGB565 strip and hands each strip to a sink, the way a display driver
+ * streams lines out (TFT_eSPI's pushImage(), an SDL texture update). Pass
+ * getFrameTableSwapped() for an SPI display that takes big-endian pixels.
+ * Sprite pixels are stored as PaletteLUT::SpriteBase + slot (drawRow()'s
+ * base), so dual-palette mode still resolves each layer with its palette.
+ *
+ * Because the stored pixels are indices, a palette change (a flash, a fade
+ * step, a dual-palette swap) costs a table rebuild and recolors the whole
+ * frame at the next present, with nothing redrawn.
+ *
+ * Drawing clips to the buffer. Source index 0 is transparent for drawRow(),
+ * as for indexed sprites.
+ */
+template <int Width, int Height, int StripRows = 8>
+class IndexedFramebuffer {
+public:
+    static_assert(Height % StripRows == 0, "Height must be a whole number of strips");
+
+    static constexpr int getWidth() { return Width; }
+    static constexpr int getHeight() { return Height; }
+    static constexpr int getBytes() { return Width * Height; }
+    static constexpr int getStripBytes() { return Width * StripRows * static_cast<int>(sizeof(uint16_t)); }
+
+    uint8_t* row(int y) { return pixels + y * Width; }
+    const uint8_t* row(int y) const { return pixels + y * Width; }
+
+    void clear(uint8_t index) { std::memset(pixels, index, sizeof(pixels)); }
+
+    void setPixel(int x, int y, uint8_t index) {
+        if (x >= 0 && x < Width && y >= 0 && y < Height) pixels[y * Width + x] = index;
+    }
+
+    void fillRect(int x, int y, int w, int h, uint8_t index) {
+        if (!clip(x, y, w, h)) return;
+        for (int r = 0; r < h; ++r) std::memset(row(y + r) + x, index, static_cast<size_t>(w));
+    }
+
+    /** @brief Copies @p count indices to (x, y) with @p base added, skipping index 0. */
+    void drawRow(int x, int y, const uint8_t* indices, int count, uint8_t base = 0) {
+        if (y < 0 || y >= Height) return;
+        int first = 0;
+        if (x < 0) {
+            first = -x;
+            x = 0;
+        }
+        if (x + (count - first) > Width) count = first + (Width - x);
+        uint8_t* dst = row(y) + x;
+        for (int i = first; i < count; ++i) {
+            const uint8_t index = indices[i];
+            if (index != 0) dst[i - first] = static_cast<uint8_t>(index + base);
+        }
+    }
+
+    /**
+     * @brief Converts the frame through @p frameLut (PaletteLUT::getFrameTable()) and streams it out.
+     *
+     * @p sink is called once per strip as sink(int y, int rows, const uint16_t* pixels),
+     * with rows * Width pixels, top to bottom.
+     */
+    template <typename Sink>
+    void present(const uint16_t* frameLut, Sink&& sink) {
+        for (int y = 0; y < Height; y += StripRows) {
+            blitFrame(strip, row(y), Width * StripRows, frameLut);
+            sink(y, StripRows, static_cast<const uint16_t*>(strip));
+        }
+    }
+
+private:
+    static bool clip(int& x, int& y, int& w, int& h) {
+        if (x < 0) {
+            w += x;
+            x = 0;
+        }
+        if (y < 0) {
+            h += y;
+            y = 0;
+        }
+        if (x + w > Width) w = Width - x;
+        if (y + h > Height) h = Height - y;
+        return w > 0 && h > 0;
+    }
+
+    uint8_t pixels[Width * Height];
+    uint16_t strip[Width * StripRows];
+};
+
+} // namespace common
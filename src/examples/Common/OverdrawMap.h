@@ -0,0 +1,309 @@
+#pragma once
+
+// The overdraw view is a native debug tool only: the map is Width * Height
+// bytes and dumps to files, neither of which belongs in an ESP32 build, even
+// one with the debug overlay turned on.
+#if defined(PLATFORM_NATIVE) && defined(PIXELROOT32_ENABLE_DEBUG_OVERLAY)
+#define PR32_COMMON_OVERDRAW_MAP 1
+#endif
+
+#ifdef PR32_COMMON_OVERDRAW_MAP
+
+#include "graphics/Renderer.h"
+#include "graphics/FontManager.h"
+#include "input/InputManager.h"
+#include "RowUnpack.h"
+#include <SDL2/SDL.h>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+namespace common {
+
+/**
+ * @brief Debug-only per-pixel overdraw counter for one scene.
+ *
+ * The scene mirrors its draw calls into the map (addRect, addSprite,
+ * addMultiSprite, addText, addTileMap), and the map counts the writes per
+ * logical pixel in an 8-bit buffer that saturates at 255. Sprites, tiles and
+ * text count only their opaque pixels, exactly as the blitters write them;
+ * scaled sprites use SpriteBatch's nearest-neighbour mapping, which is what
+ * the sprite caches blit. The engine's own frame clear and debug overlay are
+ * not counted, so 1.00x means every pixel was drawn once on top of it.
+ *
+ * drawHeatmap() shows the map as a small thumbnail (one pixel per
+ * CellSize x CellSize block, colored by the block's worst count), and
+ * writePGM() dumps the raw counts as a grayscale image for offline use.
+ *
+ * Only built for native debug builds (PLATFORM_NATIVE together with
+ * PIXELROOT32_ENABLE_DEBUG_OVERLAY, which defines PR32_COMMON_OVERDRAW_MAP);
+ * the buffer is Width * Height bytes. Scenes switch it on with
+ * OverdrawControls.
+ */
+template <int Width, int Height>
+class OverdrawMap {
+public:
+    static constexpr int CellSize = 4;
+    static constexpr int ThumbWidth = Width / CellSize;
+    static constexpr int ThumbHeight = Height / CellSize;
+
+    OverdrawMap() { beginFrame(); }
+
+    /** @brief Clears the counts; call at the start of the scene's draw(). */
+    void beginFrame() {
+        std::memset(counts, 0, sizeof(counts));
+        total = 0;
+        maxCount = 0;
+    }
+
+    void addRect(int x, int y, int w, int h) {
+        int x0 = x < 0 ? 0 : x;
+        int y0 = y < 0 ? 0 : y;
+        int x1 = x + w > Width ? Width : x + w;
+        int y1 = y + h > Height ? Height : y + h;
+        for (int py = y0; py < y1; ++py) {
+            for (int px = x0; px < x1; ++px) increment(px, py);
+        }
+    }
+
+    void addPixel(int x, int y) {
+        if (x >= 0 && x < Width && y >= 0 && y < Height) increment(x, y);
+    }
+
+    /** @brief Counts the set bits of a 1bpp sprite. */
+    void addSprite(const pixelroot32::graphics::Sprite& sprite, int x, int y, bool flipX = false) {
+        if (sprite.width > 16) return;
+        uint8_t indices[16];
+        for (int row = 0; row < sprite.height; ++row) {
+            unpackRow(sprite.data[row], sprite.width, 0, sprite.width, flipX, indices);
+            addRow(indices, sprite.width, x, y + row);
+        }
+    }
+
+    /** @brief Counts the set bits of a 1bpp sprite drawn at a fractional scale. */
+    void addSprite(const pixelroot32::graphics::Sprite& sprite, int x, int y, float scaleX, float scaleY,
+                   bool flipX = false) {
+        addScaledBits(sprite.data, sprite.width, sprite.height, nullptr, 0, x, y, scaleX, scaleY, flipX);
+    }
+
+    /**
+     * @brief Counts a scaled MultiSprite.
+     * @param layered true when every layer is blitted in turn (each layer counts),
+     *        false when the layers are flattened into one bitmap (their union counts once).
+     */
+    void addMultiSprite(const pixelroot32::graphics::MultiSprite& sprite, int x, int y, float scaleX, float scaleY,
+                        bool layered = true) {
+        if (layered) {
+            for (int i = 0; i < sprite.layerCount; ++i) {
+                addScaledBits(sprite.layers[i].data, sprite.width, sprite.height, nullptr, 0, x, y, scaleX, scaleY,
+                              false);
+            }
+        } else {
+            addScaledBits(nullptr, sprite.width, sprite.height, sprite.layers, sprite.layerCount, x, y, scaleX,
+                          scaleY, false);
+        }
+    }
+
+    /** @brief Counts the pixels Renderer::drawText writes with the default font. */
+    void addText(const char* text, int x, int y, uint8_t size) {
+        const pixelroot32::graphics::Font* font = pixelroot32::graphics::FontManager::getDefaultFont();
+        if (!font || !text || font->glyphWidth > 16) return;
+        const int advance = (font->glyphWidth + font->spacing) * size;
+        for (int i = 0; text[i]; ++i) {
+            const unsigned char c = static_cast<unsigned char>(text[i]);
+            if (c < font->firstChar || c > font->lastChar) continue;
+            const pixelroot32::graphics::Sprite& glyph = font->glyphs[c - font->firstChar];
+            uint8_t bits[16];
+            for (int row = 0; row < font->glyphHeight; ++row) {
+                unpackRow(glyph.data[row], font->glyphWidth, 0, font->glyphWidth, false, bits);
+                for (int gx = 0; gx < font->glyphWidth; ++gx) {
+                    if (bits[gx]) addRect(x + i * advance + gx * size, y + row * size, size, size);
+                }
+            }
+        }
+    }
+
+    /** @brief addText() placed as Renderer::drawTextCentered places it. */
+    void addTextCentered(const char* text, int y, uint8_t size) {
+        const pixelroot32::graphics::Font* font = pixelroot32::graphics::FontManager::getDefaultFont();
+        if (!font || !text) return;
+        const int length = static_cast<int>(std::strlen(text));
+        const int width = length > 0 ? length * (font->glyphWidth + font->spacing) * size - font->spacing * size : 0;
+        addText(text, (Width - width) / 2, y, size);
+    }
+
+#ifdef PIXELROOT32_ENABLE_2BPP_SPRITES
+    void addSprite(const pixelroot32::graphics::Sprite2bpp& sprite, int x, int y, bool flipX = false) {
+        addIndexed(sprite.data, 2, sprite.width, sprite.height, x, y, flipX);
+    }
+#endif
+
+#ifdef PIXELROOT32_ENABLE_4BPP_SPRITES
+    void addSprite(const pixelroot32::graphics::Sprite4bpp& sprite, int x, int y, bool flipX = false) {
+        addIndexed(sprite.data, 4, sprite.width, sprite.height, x, y, flipX);
+    }
+
+    /** @brief Counts every on-screen tile; index 0 is the editor's empty tile and is skipped. */
+    void addTileMap(const pixelroot32::graphics::TileMap4bpp& map, int x, int y) {
+        for (int ty = 0; ty < map.height; ++ty) {
+            const int py = y + ty * map.tileHeight;
+            if (py >= Height || py + map.tileHeight <= 0) continue;
+            for (int tx = 0; tx < map.width; ++tx) {
+                const int px = x + tx * map.tileWidth;
+                if (px >= Width || px + map.tileWidth <= 0) continue;
+                const uint8_t index = map.indices[ty * map.width + tx];
+                if (index == 0 || index >= map.tileCount) continue;
+                addSprite(map.tiles[index], px, py);
+            }
+        }
+    }
+#endif
+
+    /** @brief Pixel writes this frame, as a percentage of the screen (100 = drawn once). */
+    unsigned long getOverdrawPercent() const {
+        return (total * 100UL) / (static_cast<unsigned long>(Width) * Height);
+    }
+
+    unsigned long getTotal() const { return total; }
+    int getMax() const { return maxCount; }
+
+    /** @brief Draws the thumbnail with its top-left corner at (x, y). */
+    void drawHeatmap(pixelroot32::graphics::Renderer& renderer, int x, int y) const {
+        renderer.drawFilledRectangle(x - 1, y - 1, ThumbWidth + 2, ThumbHeight + 2,
+                                     pixelroot32::graphics::Color::DarkGray);
+        for (int cy = 0; cy < ThumbHeight; ++cy) {
+            for (int cx = 0; cx < ThumbWidth; ++cx) {
+                renderer.drawPixel(x + cx, y + cy, heatColor(cellMax(cx, cy)));
+            }
+        }
+    }
+
+    /**
+     * @brief Writes the counts as a binary PGM, scaled so the frame's maximum is white.
+     * @return false if the file could not be written.
+     */
+    bool writePGM(const char* path) const {
+        std::FILE* file = std::fopen(path, "wb");
+        if (!file) return false;
+        std::fprintf(file, "P5\n%d %d\n255\n", Width, Height);
+        const int scale = maxCount > 0 ? 255 / maxCount : 0;
+        uint8_t row[Width];
+        bool ok = true;
+        for (int y = 0; y < Height && ok; ++y) {
+            for (int x = 0; x < Width; ++x) {
+                row[x] = static_cast<uint8_t>(counts[y][x] * scale);
+            }
+            ok = std::fwrite(row, 1, Width, file) == static_cast<size_t>(Width);
+        }
+        return std::fclose(file) == 0 && ok;
+    }
+
+private:
+    void increment(int x, int y) {
+        uint8_t& c = counts[y][x];
+        if (c < 255) ++c;
+        if (c > maxCount) maxCount = c;
+        ++total;
+    }
+
+    void addRow(const uint8_t* indices, int width, int x, int y) {
+        if (y < 0 || y >= Height) return;
+        for (int i = 0; i < width; ++i) {
+            if (indices[i] != 0) addPixel(x + i, y);
+        }
+    }
+
+    // Scaled size and source mapping as in SpriteBatch::prepare(). With @p layers
+    // set, a pixel is opaque if any layer has it (a flattened MultiSprite).
+    void addScaledBits(const uint16_t* data, int srcWidth, int srcHeight,
+                       const pixelroot32::graphics::SpriteLayer* layers, int layerCount,
+                       int x, int y, float scaleX, float scaleY, bool flipX) {
+        if (srcWidth <= 0 || srcHeight <= 0) return;
+        const int width = static_cast<int>(srcWidth * scaleX + 0.99f);
+        const int height = static_cast<int>(srcHeight * scaleY + 0.99f);
+        for (int dy = 0; dy < height; ++dy) {
+            int sy = static_cast<int>(dy / scaleY);
+            if (sy >= srcHeight) sy = srcHeight - 1;
+            uint16_t srcRow = data ? data[sy] : 0;
+            for (int i = 0; i < layerCount; ++i) srcRow |= layers[i].data[sy];
+            for (int dx = 0; dx < width; ++dx) {
+                int sx = static_cast<int>(dx / scaleX);
+                if (sx >= srcWidth) sx = srcWidth - 1;
+                if (srcRow & (1u << sx)) addPixel(x + (flipX ? width - 1 - dx : dx), y + dy);
+            }
+        }
+    }
+
+    void addIndexed(const uint8_t* data, int bpp, int width, int height, int x, int y, bool flipX) {
+        const int stride = ((width * bpp + 15) / 16) * 2;
+        uint8_t indices[255];
+        for (int row = 0; row < height; ++row) {
+            unpackRow(data + row * stride, bpp, width, 0, width, flipX, indices);
+            addRow(indices, width, x, y + row);
+        }
+    }
+
+    int cellMax(int cx, int cy) const {
+        int worst = 0;
+        for (int y = cy * CellSize; y < (cy + 1) * CellSize; ++y) {
+            for (int x = cx * CellSize; x < (cx + 1) * CellSize; ++x) {
+                if (counts[y][x] > worst) worst = counts[y][x];
+            }
+        }
+        return worst;
+    }
+
+    static pixelroot32::graphics::Color heatColor(int count) {
+        using pixelroot32::graphics::Color;
+        switch (count) {
+            case 0: return Color::Black;
+            case 1: return Color::Navy;
+            case 2: return Color::Green;
+            case 3: return Color::Yellow;
+            case 4: return Color::Orange;
+            default: return Color::Red;
+        }
+    }
+
+    uint8_t counts[Height][Width];
+    unsigned long total = 0;
+    int maxCount = 0;
+};
+
+/**
+ * @brief Switches a scene's overdraw view on and off and asks for dumps.
+ *
+ * The view starts hidden. B toggles it, and while it is shown the P key (read
+ * from the SDL keyboard, since the games use every engine button) requests
+ * one PGM dump of the next frame. Call update() once per scene update.
+ */
+class OverdrawControls {
+public:
+    static constexpr uint8_t ToggleButton = 5;  // B (Enter)
+    static constexpr SDL_Scancode DumpKey = SDL_SCANCODE_P;
+
+    void update(const pixelroot32::input::InputManager& input) {
+        if (input.isButtonPressed(ToggleButton)) visible = !visible;
+        const bool down = SDL_GetKeyboardState(nullptr)[DumpKey] != 0;
+        if (visible && down && !dumpKeyDown) dumpRequested = true;
+        dumpKeyDown = down;
+    }
+
+    bool isVisible() const { return visible; }
+
+    /** @brief True once per P press while the view is shown. */
+    bool takeDumpRequest() {
+        const bool requested = dumpRequested;
+        dumpRequested = false;
+        return requested;
+    }
+
+private:
+    bool visible = false;
+    bool dumpKeyDown = false;
+    bool dumpRequested = false;
+};
+
+} // namespace common
+
+#endif // PR32_COMMON_OVERDRAW_MAP
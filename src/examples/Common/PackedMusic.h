@@ -0,0 +1,488 @@
+#pragma once
+#include "audio/AudioMusicTypes.h"
+#include <cstdint>
+
+#ifdef PLATFORM_NATIVE
+#include <cstdio>
+#endif
+
+namespace common {
+
+/**
+ * Packed music byte codes. Pitches are semitones from C0 (octave * 12 +
+ * note); durations and volumes are indices into the song's tables, most
+ * used first so the short forms cover most notes.
+ *
+ *   00ddd ppp  NOTE  duration d, pitch = previous + (p - 4)
+ *   01ddd 000  REST  duration d
+ *   10vvvvvv   VOLUME v for the following notes
+ *   0xC0 p d   NOTE  absolute pitch p, duration d
+ *   0xC1 d     REST  duration d
+ *   0xC2 i n   CALL  pattern i, n times
+ *   0xC3       END   of a pattern, or of a track (which then loops or stops)
+ *
+ * A track starts with pitch 0 and volume 0; a pattern always sets both
+ * before its first note, so it plays the same from any call site.
+ */
+namespace packedmusic {
+constexpr uint8_t NOTE_DELTA = 0x00;
+constexpr uint8_t REST = 0x40;
+constexpr uint8_t VOLUME = 0x80;
+constexpr uint8_t NOTE_ABS = 0xC0;
+constexpr uint8_t REST_LONG = 0xC1;
+constexpr uint8_t CALL = 0xC2;
+constexpr uint8_t END = 0xC3;
+constexpr int MaxShortDuration = 7;
+constexpr int MaxDelta = 3;
+constexpr int MinDelta = -4;
+constexpr int MaxCallDepth = 3;
+} // namespace packedmusic
+
+/** @brief One track of a PackedSong. */
+struct PackedTrack {
+    uint16_t start;  // Offset of the track's stream in PackedSong::data
+    pixelroot32::audio::WaveType channelType;
+    float duty;
+    bool loop;
+};
+
+/** @brief A song in the packed format: byte streams plus shared tables. */
+struct PackedSong {
+    const uint8_t* data;
+    uint16_t size;
+    const uint16_t* patterns;  // Offsets of pattern streams in data
+    uint8_t patternCount;
+    const float* durations;    // Seconds
+    uint8_t durationCount;
+    const float* volumes;
+    uint8_t volumeCount;
+    const PackedTrack* tracks;
+    uint8_t trackCount;
+};
+
+/**
+ * @brief Streams MusicNotes out of one PackedSong track.
+ *
+ * The whole decoder state is a read position, the current pitch and volume,
+ * and a three-level call stack: a few dozen bytes, whatever the song's
+ * length. Notes are decoded one at a time, when the player needs the next
+ * one.
+ */
+class PackedTrackReader {
+public:
+    void begin(const PackedSong& song, int track) {
+        this->song = &song;
+        info = &song.tracks[track];
+        restart();
+    }
+
+    /**
+     * @brief Decodes the next note or rest.
+     * @return false when a non-looping track has ended (or the data is malformed).
+     */
+    bool next(pixelroot32::audio::MusicNote& note) {
+        if (!song) return false;
+        // Bounded so a malformed stream of calls or ENDs cannot spin forever.
+        for (int guard = 0; guard < 64; ++guard) {
+            if (position >= song->size) return false;
+            const uint8_t code = song->data[position++];
+
+            if (code < packedmusic::REST) {
+                pitch = static_cast<uint8_t>(pitch + (code & 0x07) + packedmusic::MinDelta);
+                return emitNote(note, (code >> 3) & 0x07);
+            }
+            if (code < packedmusic::VOLUME) return emitRest(note, (code >> 3) & 0x07);
+            if (code < packedmusic::NOTE_ABS) {
+                volume = code & 0x3F;
+                continue;
+            }
+
+            switch (code) {
+                case packedmusic::NOTE_ABS:
+                    if (position + 2 > song->size) return false;
+                    pitch = song->data[position];
+                    position += 2;
+                    return emitNote(note, song->data[position - 1]);
+                case packedmusic::REST_LONG:
+                    if (position + 1 > song->size) return false;
+                    return emitRest(note, song->data[position++]);
+                case packedmusic::CALL: {
+                    if (position + 2 > song->size) return false;
+                    const uint8_t index = song->data[position];
+                    const uint8_t count = song->data[position + 1];
+                    position += 2;
+                    if (index >= song->patternCount || count == 0 || depth >= packedmusic::MaxCallDepth) return false;
+                    stack[depth++] = { position, song->patterns[index], count };
+                    position = song->patterns[index];
+                    continue;
+                }
+                case packedmusic::END:
+                    if (depth > 0) {
+                        Frame& frame = stack[depth - 1];
+                        if (--frame.repeats > 0) {
+                            position = frame.start;
+                        } else {
+                            position = frame.ret;
+                            --depth;
+                        }
+                        continue;
+                    }
+                    if (!info->loop) return false;
+                    restart();
+                    continue;
+                default:
+                    return false;
+            }
+        }
+        return false;
+    }
+
+    const PackedTrack& getTrack() const { return *info; }
+
+private:
+    struct Frame {
+        uint16_t ret;
+        uint16_t start;
+        uint8_t repeats;
+    };
+
+    void restart() {
+        position = info->start;
+        pitch = 0;
+        volume = 0;
+        depth = 0;
+    }
+
+    bool emitNote(pixelroot32::audio::MusicNote& note, uint8_t duration) {
+        note.note = static_cast<pixelroot32::audio::Note>(pitch % 12);
+        note.octave = static_cast<uint8_t>(pitch / 12);
+        note.duration = duration < song->durationCount ? song->durations[duration] : 0.0f;
+        note.volume = volume < song->volumeCount ? song->volumes[volume] : 0.0f;
+        return true;
+    }
+
+    bool emitRest(pixelroot32::audio::MusicNote& note, uint8_t duration) {
+        note.note = pixelroot32::audio::Note::Rest;
+        note.octave = 0;
+        note.duration = duration < song->durationCount ? song->durations[duration] : 0.0f;
+        note.volume = 0.0f;
+        return true;
+    }
+
+    const PackedSong* song = nullptr;
+    const PackedTrack* info = nullptr;
+    uint16_t position = 0;
+    uint8_t pitch = 0;
+    uint8_t volume = 0;
+    uint8_t depth = 0;
+    Frame stack[packedmusic::MaxCallDepth];
+};
+
+/**
+ * @brief Converts MusicTrack tables into a PackedSong.
+ *
+ * Durations and volumes become table indices, sorted by use, and pitches
+ * are stored as the step from the previous note where it fits in three
+ * bits. A run of notes that repeats back to back (a bar played twice, a
+ * drum loop) is stored once as a pattern and called with a repeat count;
+ * identical patterns are shared between tracks.
+ *
+ * Like PropFontBuilder, the result can be played directly or written out
+ * with writeHeader() on the native build and compiled in as flash data, so
+ * devices never run the conversion.
+ */
+template <int MaxBytes = 1024, int MaxTracks = 4, int MaxPatterns = 16, int MaxDurations = 32, int MaxVolumes = 64>
+class PackedSongBuilder {
+public:
+    /** @brief Queues a track for build(). @return false if MaxTracks are queued. */
+    bool addTrack(const pixelroot32::audio::MusicTrack& track) {
+        if (trackCount >= MaxTracks || !track.notes) return false;
+        sources[trackCount++] = &track;
+        return true;
+    }
+
+    /** @brief Encodes every queued track. @return false if a table or the buffer overflowed. */
+    bool build() {
+        valid = false;
+        size = 0;
+        patternCount = 0;
+        pendingCount = 0;
+        durationCount = 0;
+        volumeCount = 0;
+        if (!collectTables()) return false;
+
+        for (int t = 0; t < trackCount; ++t) {
+            const pixelroot32::audio::MusicTrack& source = *sources[t];
+            tracks[t] = { static_cast<uint16_t>(size), source.channelType, source.duty, source.loop };
+            State state{ 0, 0 };
+            if (!encodeRun(source.notes, source.count, state, true) || !put(packedmusic::END)) return false;
+            if (!encodePendingPatterns()) return false;
+        }
+        song = { data, static_cast<uint16_t>(size), patterns, static_cast<uint8_t>(patternCount), durations,
+                 static_cast<uint8_t>(durationCount), volumes, static_cast<uint8_t>(volumeCount), tracks,
+                 static_cast<uint8_t>(trackCount) };
+        valid = true;
+        return true;
+    }
+
+    const PackedSong& get() const { return song; }
+    bool isValid() const { return valid; }
+
+    /** @brief Flash used by the packed song: streams, tables and track list. */
+    int getPackedBytes() const {
+        return size + patternCount * static_cast<int>(sizeof(uint16_t)) +
+               (durationCount + volumeCount) * static_cast<int>(sizeof(float)) +
+               trackCount * static_cast<int>(sizeof(PackedTrack)) + static_cast<int>(sizeof(PackedSong));
+    }
+
+    /** @brief Flash used by the source MusicNote arrays and MusicTracks. */
+    int getSourceBytes() const {
+        int bytes = 0;
+        for (int t = 0; t < trackCount; ++t) {
+            bytes += sources[t]->count * static_cast<int>(sizeof(pixelroot32::audio::MusicNote)) +
+                     static_cast<int>(sizeof(pixelroot32::audio::MusicTrack));
+        }
+        return bytes;
+    }
+
+    int getPatternCount() const { return patternCount; }
+
+#ifdef PLATFORM_NATIVE
+    /** @brief Writes the song as a header of constant arrays named NAME_*. */
+    bool writeHeader(const char* path, const char* name) const {
+        if (!valid) return false;
+        std::FILE* file = std::fopen(path, "w");
+        if (!file) return false;
+        std::fprintf(file, "#pragma once\n// Generated by common::PackedSongBuilder.\n");
+        std::fprintf(file, "#include \"examples/Common/PackedMusic.h\"\n\n");
+        std::fprintf(file, "inline constexpr uint8_t %s_DATA[] = {", name);
+        for (int i = 0; i < size; ++i) std::fprintf(file, "%s0x%02X,", (i % 12) ? " " : "\n    ", data[i]);
+        std::fprintf(file, "\n};\n\n");
+        if (patternCount) {
+            std::fprintf(file, "inline constexpr uint16_t %s_PATTERNS[] = {", name);
+            for (int i = 0; i < patternCount; ++i) std::fprintf(file, " %u,", patterns[i]);
+            std::fprintf(file, " };\n\n");
+        }
+        std::fprintf(file, "inline constexpr float %s_DURATIONS[] = {", name);
+        for (int i = 0; i < durationCount; ++i) std::fprintf(file, " %.9gf,", durations[i]);
+        std::fprintf(file, " };\n\ninline constexpr float %s_VOLUMES[] = {", name);
+        for (int i = 0; i < volumeCount; ++i) std::fprintf(file, " %.9gf,", volumes[i]);
+        std::fprintf(file, " };\n\ninline constexpr common::PackedTrack %s_TRACKS[] = {\n", name);
+        static const char* const WAVES[] = { "PULSE", "TRIANGLE", "NOISE" };
+        for (int i = 0; i < trackCount; ++i) {
+            std::fprintf(file, "    { %u, pixelroot32::audio::WaveType::%s, %.9gf, %s },\n", tracks[i].start,
+                         WAVES[static_cast<int>(tracks[i].channelType)], tracks[i].duty,
+                         tracks[i].loop ? "true" : "false");
+        }
+        std::fprintf(file, "};\n\ninline constexpr common::PackedSong %s = {\n", name);
+        std::fprintf(file, "    %s_DATA, %d, ", name, size);
+        if (patternCount) {
+            std::fprintf(file, "%s_PATTERNS, %d,\n", name, patternCount);
+        } else {
+            std::fprintf(file, "nullptr, 0,\n");
+        }
+        std::fprintf(file, "    %s_DURATIONS, %d, %s_VOLUMES, %d, %s_TRACKS, %d\n};\n", name, durationCount, name,
+                     volumeCount, name, trackCount);
+        return std::fclose(file) == 0;
+    }
+#endif
+
+private:
+    // Pitch and volume the decoder holds at this point; -1 when it depends on the call site.
+    struct State {
+        int pitch;
+        int volume;
+    };
+
+    static constexpr int MinRepeatNotes = 2;
+    static constexpr int MaxPatternNotes = 32;
+
+    static bool isRest(const pixelroot32::audio::MusicNote& note) {
+        return static_cast<int>(note.note) >= 12;
+    }
+
+    static bool sameNote(const pixelroot32::audio::MusicNote& a, const pixelroot32::audio::MusicNote& b) {
+        if (isRest(a) || isRest(b)) return isRest(a) && isRest(b) && a.duration == b.duration;
+        return a.note == b.note && a.octave == b.octave && a.duration == b.duration && a.volume == b.volume;
+    }
+
+    // Builds both tables, then orders each by use so the short codes cover the common values.
+    bool collectTables() {
+        int durationUses[MaxDurations] = {};
+        int volumeUses[MaxVolumes] = {};
+        for (int t = 0; t < trackCount; ++t) {
+            for (int i = 0; i < sources[t]->count; ++i) {
+                const pixelroot32::audio::MusicNote& note = sources[t]->notes[i];
+                const int d = findOrAdd(durations, durationCount, MaxDurations, note.duration);
+                if (d < 0) return false;
+                ++durationUses[d];
+                if (isRest(note)) continue;
+                const int v = findOrAdd(volumes, volumeCount, MaxVolumes, note.volume);
+                if (v < 0) return false;
+                ++volumeUses[v];
+            }
+        }
+        sortByUse(durations, durationUses, durationCount);
+        sortByUse(volumes, volumeUses, volumeCount);
+        return true;
+    }
+
+    static int findOrAdd(float* table, int& count, int capacity, float value) {
+        for (int i = 0; i < count; ++i) {
+            if (table[i] == value) return i;
+        }
+        if (count >= capacity) return -1;
+        table[count] = value;
+        return count++;
+    }
+
+    static void sortByUse(float* table, int* uses, int count) {
+        for (int i = 1; i < count; ++i) {
+            for (int j = i; j > 0 && uses[j] > uses[j - 1]; --j) {
+                const float value = table[j];
+                table[j] = table[j - 1];
+                table[j - 1] = value;
+                const int use = uses[j];
+                uses[j] = uses[j - 1];
+                uses[j - 1] = use;
+            }
+        }
+    }
+
+    static int indexOf(const float* table, int count, float value) {
+        for (int i = 0; i < count; ++i) {
+            if (table[i] == value) return i;
+        }
+        return 0;
+    }
+
+    bool put(uint8_t byte) {
+        if (size >= MaxBytes) return false;
+        data[size++] = byte;
+        return true;
+    }
+
+    // Longest back-to-back repeat starting at notes[0]: run length and repeat count.
+    static void findRepeat(const pixelroot32::audio::MusicNote* notes, int count, int& length, int& repeats) {
+        length = 0;
+        repeats = 0;
+        int bestCovered = 0;
+        for (int len = MinRepeatNotes; len <= MaxPatternNotes && len * 2 <= count; ++len) {
+            int reps = 1;
+            while ((reps + 1) * len <= count) {
+                bool same = true;
+                for (int i = 0; i < len && same; ++i) same = sameNote(notes[i], notes[reps * len + i]);
+                if (!same) break;
+                ++reps;
+            }
+            if (reps >= 2 && reps * len > bestCovered) {
+                bestCovered = reps * len;
+                length = len;
+                repeats = reps > 255 ? 255 : reps;
+            }
+        }
+    }
+
+    // Encodes notes into the stream; allowPatterns is false inside a pattern (no nested calls).
+    bool encodeRun(const pixelroot32::audio::MusicNote* notes, int count, State& state, bool allowPatterns) {
+        int i = 0;
+        while (i < count) {
+            int length = 0;
+            int repeats = 0;
+            if (allowPatterns) findRepeat(notes + i, count - i, length, repeats);
+            // A call costs three bytes; only worth it when the repeats save more than that.
+            if (length > 0 && length * (repeats - 1) > 3) {
+                const int pattern = findOrAddPattern(notes + i, length);
+                if (pattern < 0) return false;
+                if (!put(packedmusic::CALL) || !put(static_cast<uint8_t>(pattern)) || !put(static_cast<uint8_t>(repeats))) {
+                    return false;
+                }
+                // The decoder leaves the pattern with its last pitch and volume.
+                for (int n = 0; n < length; ++n) {
+                    if (isRest(notes[i + n])) continue;
+                    state.pitch = notes[i + n].octave * 12 + static_cast<int>(notes[i + n].note);
+                    state.volume = indexOf(volumes, volumeCount, notes[i + n].volume);
+                }
+                i += length * repeats;
+                continue;
+            }
+            if (!encodeNote(notes[i], state)) return false;
+            ++i;
+        }
+        return true;
+    }
+
+    bool encodeNote(const pixelroot32::audio::MusicNote& note, State& state) {
+        const int duration = indexOf(durations, durationCount, note.duration);
+        if (isRest(note)) {
+            if (duration <= packedmusic::MaxShortDuration) return put(static_cast<uint8_t>(packedmusic::REST | (duration << 3)));
+            return put(packedmusic::REST_LONG) && put(static_cast<uint8_t>(duration));
+        }
+
+        const int volume = indexOf(volumes, volumeCount, note.volume);
+        if (volume != state.volume) {
+            if (!put(static_cast<uint8_t>(packedmusic::VOLUME | volume))) return false;
+            state.volume = volume;
+        }
+
+        const int pitch = note.octave * 12 + static_cast<int>(note.note);
+        const int delta = pitch - state.pitch;
+        const bool shortForm = state.pitch >= 0 && duration <= packedmusic::MaxShortDuration &&
+                               delta >= packedmusic::MinDelta && delta <= packedmusic::MaxDelta;
+        state.pitch = pitch;
+        if (shortForm) {
+            return put(static_cast<uint8_t>(packedmusic::NOTE_DELTA | (duration << 3) | (delta - packedmusic::MinDelta)));
+        }
+        return put(packedmusic::NOTE_ABS) && put(static_cast<uint8_t>(pitch)) && put(static_cast<uint8_t>(duration));
+    }
+
+    // Patterns are appended to the stream after the code that calls them; identical ones are shared.
+    int findOrAddPattern(const pixelroot32::audio::MusicNote* notes, int length) {
+        for (int p = 0; p < patternCount; ++p) {
+            if (patternLengths[p] != length) continue;
+            bool same = true;
+            for (int i = 0; i < length && same; ++i) same = sameNote(patternNotes[p][i], notes[i]);
+            if (same) return p;
+        }
+        if (patternCount >= MaxPatterns) return -1;
+
+        const int p = patternCount;
+        patternNotes[p] = notes;
+        patternLengths[p] = length;
+        pendingPatterns[pendingCount++] = p;
+        ++patternCount;
+        return p;
+    }
+
+    bool encodePendingPatterns() {
+        for (int i = 0; i < pendingCount; ++i) {
+            const int p = pendingPatterns[i];
+            patterns[p] = static_cast<uint16_t>(size);
+            State state{ -1, -1 };
+            if (!encodeRun(patternNotes[p], patternLengths[p], state, false) || !put(packedmusic::END)) return false;
+        }
+        pendingCount = 0;
+        return true;
+    }
+
+    const pixelroot32::audio::MusicTrack* sources[MaxTracks] = {};
+    int trackCount = 0;
+
+    uint8_t data[MaxBytes];
+    int size = 0;
+    uint16_t patterns[MaxPatterns];
+    const pixelroot32::audio::MusicNote* patternNotes[MaxPatterns];
+    int patternLengths[MaxPatterns];
+    int pendingPatterns[MaxPatterns];
+    int pendingCount = 0;
+    int patternCount = 0;
+    float durations[MaxDurations];
+    int durationCount = 0;
+    float volumes[MaxVolumes];
+    int volumeCount = 0;
+    PackedTrack tracks[MaxTracks];
+    PackedSong song{};
+    bool valid = false;
+};
+
+} // namespace common
@@ -0,0 +1,135 @@
+#pragma once
+#include <cstdint>
+
+namespace common {
+
+/** @brief Which of the two palettes a pixel is drawn with. */
+enum class PaletteLayer : uint8_t {
+    BACKGROUND,
+    SPRITE
+};
+
+/**
+ * @brief Ready-to-write RGB565 tables for the background and sprite palettes.
+ *
+ * Resolving an indexed pixel at draw time means checking dual-palette mode
+ * and the pixel's layer, picking a palette and, for an SPI display, swapping
+ * the bytes: several branches per pixel for a result that only changes when
+ * a scene switches palettes. PaletteLUT does that work in the setters
+ * instead. Every palette change rebuilds one flat table per layer, plus a
+ * byte-swapped copy of each for displays that take big-endian RGB565, so a
+ * blitter does one table load per pixel (blitIndexed()) whatever the mode.
+ *
+ * The calls mirror the engine's: setPalette() for one palette (as
+ * setCustomPalette()), enableDualPaletteMode() with setBackgroundPalette()
+ * and setSpritePalette() for two. Palettes are 16-entry RGB565 arrays, like the
+ * custom palettes passed to setCustomPalette(), indexed by palette slot
+ * (the Color value for the base colors, or a 4bpp sprite's pixel). The
+ * tables are copies, so the source arrays may change or go away.
+ *
+ * A frame of stored indices (IndexedFramebuffer) no longer knows which layer
+ * a pixel came from, so the frame table joins both: slots 0-15 are the
+ * background table and SpriteBase + slot the sprite table. Sprites drawn
+ * into such a frame add SpriteBase to their indices.
+ */
+class PaletteLUT {
+public:
+    static constexpr int Size = 16;
+    static constexpr int FrameSize = 2 * Size;  // Background slots, then sprite slots
+    static constexpr uint8_t SpriteBase = Size;
+
+    PaletteLUT() {
+        for (int i = 0; i < Size; ++i) {
+            background[i] = 0;
+            sprite[i] = 0;
+        }
+        rebuild();
+    }
+
+    /** @brief One palette for both layers (leaves dual mode as it is). */
+    void setPalette(const uint16_t* rgb565) {
+        copy(background, rgb565);
+        copy(sprite, rgb565);
+        rebuild();
+    }
+
+    void setBackgroundPalette(const uint16_t* rgb565) {
+        copy(background, rgb565);
+        rebuild();
+    }
+
+    /** @brief Sprite palette; only used while dual-palette mode is on. */
+    void setSpritePalette(const uint16_t* rgb565) {
+        copy(sprite, rgb565);
+        rebuild();
+    }
+
+    /** @brief Off: both layers draw with the background palette. */
+    void enableDualPaletteMode(bool enabled) {
+        dual = enabled;
+        rebuild();
+    }
+
+    bool isDualPaletteMode() const { return dual; }
+
+    /** @brief Table for @p layer, native byte order. */
+    const uint16_t* get(PaletteLayer layer) const { return tables[static_cast<int>(layer)]; }
+
+    /** @brief Table for @p layer with each entry byte-swapped, for SPI displays. */
+    const uint16_t* getSwapped(PaletteLayer layer) const { return swapped[static_cast<int>(layer)]; }
+
+    /** @brief Both layers in one table, for a frame of stored indices (see blitFrame()). */
+    const uint16_t* getFrameTable() const { return frame; }
+    const uint16_t* getFrameTableSwapped() const { return frameSwapped; }
+
+    /** @brief Tables built since construction; one per palette change. */
+    unsigned long getRebuildCount() const { return rebuilds; }
+
+private:
+    static void copy(uint16_t* dst, const uint16_t* src) {
+        for (int i = 0; i < Size; ++i) dst[i] = src ? src[i] : 0;
+    }
+
+    void rebuild() {
+        const uint16_t* sources[2] = { background, dual ? sprite : background };
+        for (int layer = 0; layer < 2; ++layer) {
+            for (int i = 0; i < Size; ++i) {
+                const uint16_t color = sources[layer][i];
+                tables[layer][i] = color;
+                swapped[layer][i] = static_cast<uint16_t>((color >> 8) | (color << 8));
+                frame[layer * Size + i] = tables[layer][i];
+                frameSwapped[layer * Size + i] = swapped[layer][i];
+            }
+        }
+        ++rebuilds;
+    }
+
+    uint16_t background[Size];
+    uint16_t sprite[Size];
+    uint16_t tables[2][Size];
+    uint16_t swapped[2][Size];
+    uint16_t frame[FrameSize];
+    uint16_t frameSwapped[FrameSize];
+    bool dual = false;
+    unsigned long rebuilds = 0;
+};
+
+/** @brief Writes @p count indexed pixels through @p lut (a PaletteLUT table). */
+inline void blitIndexed(uint16_t* dst, const uint8_t* indices, int count, const uint16_t* lut) {
+    for (int i = 0; i < count; ++i) dst[i] = lut[indices[i] & (PaletteLUT::Size - 1)];
+}
+
+/** @brief As blitIndexed(), leaving pixels with index 0 (transparent) untouched. */
+inline void blitIndexedKeyed(uint16_t* dst, const uint8_t* indices, int count, const uint16_t* lut) {
+    for (int i = 0; i < count; ++i) {
+        const uint8_t index = indices[i] & (PaletteLUT::Size - 1);
+        if (index != 0) dst[i] = lut[index];
+    }
+}
+
+/** @brief Writes @p count stored frame indices through a getFrameTable() table. */
+inline void blitFrame(uint16_t* dst, const uint8_t* indices, int count, const uint16_t* frameLut) {
+    for (int i = 0; i < count; ++i) dst[i] = frameLut[indices[i] & (PaletteLUT::FrameSize - 1)];
+}
+
+} // namespace common
@@ -0,0 +1,230 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#if defined(__GNUC__)
+#include <immintrin.h>
+#define PR32_COMMON_HAS_AVX2_DISPATCH 1
+#endif
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace common {
+
+/**
+ * @brief RGB565 span kernels: fill, copy, color-keyed copy and 2x upscale.
+ *
+ * These are the inner loops of a 16-bit framebuffer backend: clears and
+ * filled rectangles (fill), tile and sprite row blits (copy, masked copy with
+ * a transparent color key) and the logical-to-physical 2x nearest-neighbour
+ * present (upscale2x).
+ *
+ * pixelKernels() picks an implementation once, at first use: AVX2 when the
+ * CPU reports it, else SSE2 on x86-64 and NEON on ARM (both always present
+ * there), else the portable scalar loops. The ESP32 build always gets the
+ * scalar ones. Every implementation writes exactly the same pixels.
+ */
+struct PixelKernels {
+    const char* name;
+    void (*fill)(uint16_t* dst, int count, uint16_t value);
+    void (*copy)(uint16_t* dst, const uint16_t* src, int count);
+    // Copies every pixel of src except those equal to key.
+    void (*maskedCopy)(uint16_t* dst, const uint16_t* src, int count, uint16_t key);
+    // Writes a (2 * width) x (2 * height) block; strides are in pixels.
+    void (*upscale2x)(uint16_t* dst, int dstStride, const uint16_t* src, int srcStride,
+                      int width, int height);
+};
+
+namespace kernels {
+
+inline void fillScalar(uint16_t* dst, int count, uint16_t value) {
+    for (int i = 0; i < count; ++i) dst[i] = value;
+}
+
+inline void copyScalar(uint16_t* dst, const uint16_t* src, int count) {
+    std::memcpy(dst, src, static_cast<size_t>(count) * sizeof(uint16_t));
+}
+
+inline void maskedCopyScalar(uint16_t* dst, const uint16_t* src, int count, uint16_t key) {
+    for (int i = 0; i < count; ++i) {
+        if (src[i] != key) dst[i] = src[i];
+    }
+}
+
+// Doubles one source row into dst (2 * width pixels).
+inline void upscaleRowScalar(uint16_t* dst, const uint16_t* src, int width) {
+    for (int x = 0; x < width; ++x) {
+        dst[2 * x] = src[x];
+        dst[2 * x + 1] = src[x];
+    }
+}
+
+// Shared row loop: expand each source row once, then duplicate it.
+template <void (*UpscaleRow)(uint16_t*, const uint16_t*, int)>
+void upscale2xRows(uint16_t* dst, int dstStride, const uint16_t* src, int srcStride,
+                   int width, int height) {
+    for (int y = 0; y < height; ++y) {
+        uint16_t* row = dst + (2 * y) * dstStride;
+        UpscaleRow(row, src + y * srcStride, width);
+        std::memcpy(row + dstStride, row, static_cast<size_t>(2 * width) * sizeof(uint16_t));
+    }
+}
+
+#if defined(__SSE2__)
+
+inline void fillSSE2(uint16_t* dst, int count, uint16_t value) {
+    const __m128i v = _mm_set1_epi16(static_cast<short>(value));
+    int i = 0;
+    for (; i + 8 <= count; i += 8) _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), v);
+    fillScalar(dst + i, count - i, value);
+}
+
+inline void maskedCopySSE2(uint16_t* dst, const uint16_t* src, int count, uint16_t key) {
+    const __m128i k = _mm_set1_epi16(static_cast<short>(key));
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+        const __m128i keep = _mm_cmpeq_epi16(s, k);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                         _mm_or_si128(_mm_and_si128(keep, d), _mm_andnot_si128(keep, s)));
+    }
+    maskedCopyScalar(dst + i, src + i, count - i, key);
+}
+
+inline void upscaleRowSSE2(uint16_t* dst, const uint16_t* src, int width) {
+    int x = 0;
+    for (; x + 8 <= width; x += 8) {
+        const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 2 * x), _mm_unpacklo_epi16(s, s));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 2 * x + 8), _mm_unpackhi_epi16(s, s));
+    }
+    upscaleRowScalar(dst + 2 * x, src + x, width - x);
+}
+
+#if defined(PR32_COMMON_HAS_AVX2_DISPATCH)
+
+__attribute__((target("avx2"))) inline void fillAVX2(uint16_t* dst, int count, uint16_t value) {
+    const __m256i v = _mm256_set1_epi16(static_cast<short>(value));
+    int i = 0;
+    for (; i + 16 <= count; i += 16) _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), v);
+    fillScalar(dst + i, count - i, value);
+}
+
+__attribute__((target("avx2"))) inline void maskedCopyAVX2(uint16_t* dst, const uint16_t* src,
+                                                            int count, uint16_t key) {
+    const __m256i k = _mm256_set1_epi16(static_cast<short>(key));
+    int i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        const __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i),
+                            _mm256_blendv_epi8(s, d, _mm256_cmpeq_epi16(s, k)));
+    }
+    maskedCopyScalar(dst + i, src + i, count - i, key);
+}
+
+__attribute__((target("avx2"))) inline void upscaleRowAVX2(uint16_t* dst, const uint16_t* src, int width) {
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        const __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + x));
+        // unpack works per 128-bit lane; the permutes put the halves back in order.
+        const __m256i lo = _mm256_unpacklo_epi16(s, s);
+        const __m256i hi = _mm256_unpackhi_epi16(s, s);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 2 * x), _mm256_permute2x128_si256(lo, hi, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 2 * x + 16), _mm256_permute2x128_si256(lo, hi, 0x31));
+    }
+    upscaleRowSSE2(dst + 2 * x, src + x, width - x);
+}
+
+#endif // PR32_COMMON_HAS_AVX2_DISPATCH
+
+#elif defined(__ARM_NEON)
+
+inline void fillNEON(uint16_t* dst, int count, uint16_t value) {
+    const uint16x8_t v = vdupq_n_u16(value);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) vst1q_u16(dst + i, v);
+    fillScalar(dst + i, count - i, value);
+}
+
+inline void maskedCopyNEON(uint16_t* dst, const uint16_t* src, int count, uint16_t key) {
+    const uint16x8_t k = vdupq_n_u16(key);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const uint16x8_t s = vld1q_u16(src + i);
+        const uint16x8_t d = vld1q_u16(dst + i);
+        vst1q_u16(dst + i, vbslq_u16(vceqq_u16(s, k), d, s));
+    }
+    maskedCopyScalar(dst + i, src + i, count - i, key);
+}
+
+inline void upscaleRowNEON(uint16_t* dst, const uint16_t* src, int width) {
+    int x = 0;
+    for (; x + 8 <= width; x += 8) {
+        const uint16x8_t s = vld1q_u16(src + x);
+        const uint16x8x2_t z = vzipq_u16(s, s);
+        vst1q_u16(dst + 2 * x, z.val[0]);
+        vst1q_u16(dst + 2 * x + 8, z.val[1]);
+    }
+    upscaleRowScalar(dst + 2 * x, src + x, width - x);
+}
+
+#endif
+
+} // namespace kernels
+
+/** @brief The portable implementation; also the benchmark reference. */
+inline const PixelKernels& scalarPixelKernels() {
+    static const PixelKernels scalar = {
+        "SCALAR",
+        kernels::fillScalar,
+        kernels::copyScalar,
+        kernels::maskedCopyScalar,
+        kernels::upscale2xRows<kernels::upscaleRowScalar>
+    };
+    return scalar;
+}
+
+/** @brief The fastest implementation this CPU supports, selected on first call. */
+inline const PixelKernels& pixelKernels() {
+#if defined(__SSE2__)
+    // Plain copies are memcpy in every variant: libc already vectorizes it.
+    static const PixelKernels sse2 = {
+        "SSE2",
+        kernels::fillSSE2,
+        kernels::copyScalar,
+        kernels::maskedCopySSE2,
+        kernels::upscale2xRows<kernels::upscaleRowSSE2>
+    };
+#if defined(PR32_COMMON_HAS_AVX2_DISPATCH)
+    static const PixelKernels avx2 = {
+        "AVX2",
+        kernels::fillAVX2,
+        kernels::copyScalar,
+        kernels::maskedCopyAVX2,
+        kernels::upscale2xRows<kernels::upscaleRowAVX2>
+    };
+    static const PixelKernels& selected = __builtin_cpu_supports("avx2") ? avx2 : sse2;
+    return selected;
+#else
+    return sse2;
+#endif
+#elif defined(__ARM_NEON)
+    static const PixelKernels neon = {
+        "NEON",
+        kernels::fillNEON,
+        kernels::copyScalar,
+        kernels::maskedCopyNEON,
+        kernels::upscale2xRows<kernels::upscaleRowNEON>
+    };
+    return neon;
+#else
+    return scalarPixelKernels();
+#endif
+}
+
+} // namespace common
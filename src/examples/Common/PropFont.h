@@ -0,0 +1,318 @@
+#pragma once
+#include "graphics/Renderer.h"
+#include "graphics/FontManager.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+namespace common {
+
+/**
+ * @brief One glyph of a PropFont.
+ *
+ * The glyph's bitmap is width x height bits in the font's atlas, starting at
+ * bit bitOffset, row by row and LSB-first with no row padding. It is drawn
+ * xOffset / yOffset pixels from the pen position, and the pen then moves
+ * right by advance. A glyph with width 0 (space) only advances.
+ */
+struct PropGlyph {
+    uint16_t bitOffset;
+    uint8_t width;
+    uint8_t height;
+    int8_t xOffset;
+    int8_t yOffset;
+    uint8_t advance;
+};
+
+/** @brief Extra advance between two characters; tables are sorted by (left, right). */
+struct PropKerning {
+    uint8_t left;
+    uint8_t right;
+    int8_t adjust;
+};
+
+/**
+ * @brief Proportional 1bpp font: packed atlas, per-glyph metrics and optional kerning.
+ *
+ * Covers characters firstChar..lastChar (glyphs has one entry per
+ * character). kerning may be nullptr with kerningCount 0.
+ */
+struct PropFont {
+    const uint8_t* atlas;
+    const PropGlyph* glyphs;
+    const PropKerning* kerning;
+    uint16_t kerningCount;
+    uint8_t firstChar;
+    uint8_t lastChar;
+    uint8_t lineHeight;
+};
+
+/** @brief Kerning adjustment for a character pair (binary search, 0 if absent). */
+inline int kerningFor(const PropFont& font, unsigned char left, unsigned char right) {
+    const unsigned key = (static_cast<unsigned>(left) << 8) | right;
+    int lo = 0;
+    int hi = static_cast<int>(font.kerningCount) - 1;
+    while (lo <= hi) {
+        const int mid = (lo + hi) / 2;
+        const PropKerning& k = font.kerning[mid];
+        const unsigned midKey = (static_cast<unsigned>(k.left) << 8) | k.right;
+        if (midKey == key) return k.adjust;
+        if (midKey < key) lo = mid + 1;
+        else hi = mid - 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Width in pixels of a string, from advances and kerning only.
+ *
+ * Nothing is rasterized, so layouts can measure and center text in
+ * O(length). Characters outside the font take no space. The last
+ * character counts its full advance, as its trailing spacing is part of it.
+ */
+inline int measureText(const PropFont& font, const char* text, int size = 1) {
+    int width = 0;
+    unsigned char previous = 0;
+    for (const char* p = text; *p; ++p) {
+        const unsigned char c = static_cast<unsigned char>(*p);
+        if (c < font.firstChar || c > font.lastChar) continue;
+        if (previous) width += kerningFor(font, previous, c);
+        width += font.glyphs[c - font.firstChar].advance;
+        previous = c;
+    }
+    return width * size;
+}
+
+/**
+ * @brief Draws a string at (x, y), top-left of the line, scaled by size.
+ *
+ * Each glyph row is decoded from the atlas into runs of set bits, and every
+ * run is one filled rectangle (size pixels high).
+ */
+inline void drawText(pixelroot32::graphics::Renderer& renderer, const PropFont& font, const char* text,
+                     int x, int y, pixelroot32::graphics::Color color, int size = 1) {
+    unsigned char previous = 0;
+    for (const char* p = text; *p; ++p) {
+        const unsigned char c = static_cast<unsigned char>(*p);
+        if (c < font.firstChar || c > font.lastChar) continue;
+        if (previous) x += kerningFor(font, previous, c) * size;
+        const PropGlyph& glyph = font.glyphs[c - font.firstChar];
+
+        unsigned bit = glyph.bitOffset;
+        const int gx = x + glyph.xOffset * size;
+        for (int row = 0; row < glyph.height; ++row) {
+            const int gy = y + (glyph.yOffset + row) * size;
+            int runStart = -1;
+            for (int col = 0; col <= glyph.width; ++col, ++bit) {
+                const bool set = col < glyph.width && ((font.atlas[bit >> 3] >> (bit & 7)) & 1);
+                if (set && runStart < 0) {
+                    runStart = col;
+                } else if (!set && runStart >= 0) {
+                    renderer.drawFilledRectangle(gx + runStart * size, gy, (col - runStart) * size, size, color);
+                    runStart = -1;
+                }
+            }
+            --bit;  // The loop above stepped one bit past the row.
+        }
+        x += glyph.advance * size;
+        previous = c;
+    }
+}
+
+inline void drawTextCentered(pixelroot32::graphics::Renderer& renderer, const PropFont& font, const char* text,
+                             int y, pixelroot32::graphics::Color color, int size = 1) {
+    drawText(renderer, font, text, (renderer.getWidth() - measureText(font, text, size)) / 2, y, color, size);
+}
+
+/**
+ * @brief Converts a fixed-width engine Font into a PropFont.
+ *
+ * Every glyph is trimmed to the bounding box of its set pixels and packed
+ * into one bit stream; its advance becomes the trimmed width plus spacing.
+ * Empty glyphs (space) advance by spaceAdvance. addKerning() then computes
+ * pair adjustments from the glyph outlines: the right glyph moves left until
+ * it would come closer than spacing to the left glyph in any row.
+ *
+ * The result can be used directly, or written out with writeHeader() on the
+ * native build and compiled in as constant data, so devices never run the
+ * conversion.
+ */
+template <int MaxGlyphs = 96, int AtlasBytes = 512, int MaxKerning = 64>
+class PropFontBuilder {
+public:
+    bool build(const pixelroot32::graphics::Font& source, uint8_t spacing = 1, uint8_t spaceAdvance = 3) {
+        valid = false;
+        kerningCount = 0;
+        const int count = source.lastChar - source.firstChar + 1;
+        if (count <= 0 || count > MaxGlyphs || source.glyphWidth > 16) return false;
+
+        mono = &source;
+        glyphSpacing = spacing;
+        std::memset(atlas, 0, sizeof(atlas));
+        unsigned bit = 0;
+        for (int i = 0; i < count; ++i) {
+            const pixelroot32::graphics::Sprite& sprite = source.glyphs[i];
+            int left = source.glyphWidth;
+            int right = -1;
+            int top = source.glyphHeight;
+            int bottom = -1;
+            for (int row = 0; row < source.glyphHeight; ++row) {
+                for (int col = 0; col < source.glyphWidth; ++col) {
+                    if (!((sprite.data[row] >> col) & 1)) continue;
+                    if (col < left) left = col;
+                    if (col > right) right = col;
+                    if (row < top) top = row;
+                    if (row > bottom) bottom = row;
+                }
+            }
+
+            PropGlyph& glyph = glyphs[i];
+            if (right < 0) {
+                glyph = { static_cast<uint16_t>(bit), 0, 0, 0, 0, spaceAdvance };
+                trimLeft[i] = 0;
+                continue;
+            }
+            const int width = right - left + 1;
+            const int height = bottom - top + 1;
+            if (bit + static_cast<unsigned>(width * height) > AtlasBytes * 8u) return false;
+            glyph = { static_cast<uint16_t>(bit), static_cast<uint8_t>(width), static_cast<uint8_t>(height),
+                      0, static_cast<int8_t>(top), static_cast<uint8_t>(width + spacing) };
+            trimLeft[i] = static_cast<uint8_t>(left);
+            for (int row = top; row <= bottom; ++row) {
+                for (int col = left; col <= right; ++col, ++bit) {
+                    if ((sprite.data[row] >> col) & 1) atlas[bit >> 3] |= static_cast<uint8_t>(1u << (bit & 7));
+                }
+            }
+        }
+        atlasBits = bit;
+        font = { atlas, glyphs, nullptr, 0, source.firstChar, source.lastChar, source.lineHeight };
+        valid = true;
+        return true;
+    }
+
+    /**
+     * @brief Adds kerning for each pair of characters in @p pairs ("AVTo" adds AV and To).
+     * Pairs that need no adjustment are skipped.
+     * @return false if the table is full.
+     */
+    bool addKerning(const char* pairs) {
+        if (!valid) return false;
+        for (const char* p = pairs; p[0] && p[1]; p += 2) {
+            const unsigned char left = static_cast<unsigned char>(p[0]);
+            const unsigned char right = static_cast<unsigned char>(p[1]);
+            if (left < font.firstChar || left > font.lastChar || right < font.firstChar || right > font.lastChar) continue;
+            const int adjust = pairAdjust(left - font.firstChar, right - font.firstChar);
+            if (adjust == 0) continue;
+            if (kerningCount >= MaxKerning) return false;
+            insertKerning({ left, right, static_cast<int8_t>(adjust) });
+        }
+        font.kerning = kerningCount ? kerning : nullptr;
+        font.kerningCount = static_cast<uint16_t>(kerningCount);
+        return true;
+    }
+
+    bool isValid() const { return valid; }
+    const PropFont& get() const { return font; }
+    int getAtlasBytes() const { return static_cast<int>((atlasBits + 7) / 8); }
+    int getKerningCount() const { return kerningCount; }
+
+#ifdef PLATFORM_NATIVE
+    /**
+     * @brief Writes the font as a C++ header declaring <name>_ATLAS, _GLYPHS, _KERNING and <name>.
+     * @return false if the file could not be written.
+     */
+    bool writeHeader(const char* path, const char* name) const {
+        if (!valid) return false;
+        std::FILE* file = std::fopen(path, "w");
+        if (!file) return false;
+        std::fprintf(file, "#pragma once\n// Generated by common::PropFontBuilder.\n");
+        std::fprintf(file, "#include \"examples/Common/PropFont.h\"\n\n");
+        std::fprintf(file, "inline constexpr uint8_t %s_ATLAS[] = {", name);
+        for (int i = 0; i < getAtlasBytes(); ++i) {
+            std::fprintf(file, "%s0x%02X,", (i % 12) ? " " : "\n    ", atlas[i]);
+        }
+        std::fprintf(file, "\n};\n\ninline constexpr common::PropGlyph %s_GLYPHS[] = {\n", name);
+        for (int i = 0; i <= font.lastChar - font.firstChar; ++i) {
+            const PropGlyph& g = glyphs[i];
+            std::fprintf(file, "    { %u, %u, %u, %d, %d, %u },  // '%c'\n", g.bitOffset, g.width, g.height,
+                         g.xOffset, g.yOffset, g.advance, font.firstChar + i);
+        }
+        std::fprintf(file, "};\n\n");
+        if (kerningCount) {
+            std::fprintf(file, "inline constexpr common::PropKerning %s_KERNING[] = {\n", name);
+            for (int i = 0; i < kerningCount; ++i) {
+                std::fprintf(file, "    { %u, %u, %d },\n", kerning[i].left, kerning[i].right, kerning[i].adjust);
+            }
+            std::fprintf(file, "};\n\n");
+        }
+        std::fprintf(file, "inline constexpr common::PropFont %s = {\n    %s_ATLAS, %s_GLYPHS, %s%s, %d, %u, %u, %u\n};\n",
+                     name, name, name, kerningCount ? name : "nullptr", kerningCount ? "_KERNING" : "",
+                     kerningCount, font.firstChar, font.lastChar, font.lineHeight);
+        return std::fclose(file) == 0;
+    }
+#endif
+
+private:
+    // Columns the right glyph can move left, keeping `spacing` empty columns in every row.
+    int pairAdjust(int leftIndex, int rightIndex) const {
+        const PropGlyph& a = glyphs[leftIndex];
+        const PropGlyph& b = glyphs[rightIndex];
+        if (a.width == 0 || b.width == 0) return 0;
+
+        int minGap = 255;
+        for (int row = 0; row < mono->glyphHeight; ++row) {
+            const int aRight = lastSetColumn(leftIndex, row);
+            const int bLeft = firstSetColumn(rightIndex, row);
+            if (aRight < 0 || bLeft < 0) continue;
+            const int gap = (a.width - 1 - aRight) + bLeft;
+            if (gap < minGap) minGap = gap;
+        }
+        // Rows never meet (e.g. "T."): tuck by at most one glyph spacing.
+        if (minGap == 255) return -static_cast<int>(glyphSpacing);
+        return -(minGap < glyphSpacing ? minGap : glyphSpacing);
+    }
+
+    // Set-column extent of a source row, relative to the trimmed glyph; -1 if empty.
+    int firstSetColumn(int index, int row) const {
+        const uint16_t bits = mono->glyphs[index].data[row];
+        for (int col = 0; col < mono->glyphWidth; ++col) {
+            if ((bits >> col) & 1) return col - trimLeft[index];
+        }
+        return -1;
+    }
+
+    int lastSetColumn(int index, int row) const {
+        const uint16_t bits = mono->glyphs[index].data[row];
+        for (int col = mono->glyphWidth - 1; col >= 0; --col) {
+            if ((bits >> col) & 1) return col - trimLeft[index];
+        }
+        return -1;
+    }
+
+    void insertKerning(const PropKerning& entry) {
+        const unsigned key = (static_cast<unsigned>(entry.left) << 8) | entry.right;
+        for (int j = 0; j < kerningCount; ++j) {
+            if (kerning[j].left == entry.left && kerning[j].right == entry.right) return;
+        }
+        int i = kerningCount;
+        while (i > 0 && ((static_cast<unsigned>(kerning[i - 1].left) << 8) | kerning[i - 1].right) > key) {
+            kerning[i] = kerning[i - 1];
+            --i;
+        }
+        kerning[i] = entry;
+        ++kerningCount;
+    }
+
+    uint8_t atlas[AtlasBytes] = {};
+    PropGlyph glyphs[MaxGlyphs] = {};
+    uint8_t trimLeft[MaxGlyphs] = {};
+    PropKerning kerning[MaxKerning] = {};
+    PropFont font = {};
+    const pixelroot32::graphics::Font* mono = nullptr;
+    unsigned atlasBits = 0;
+    int kerningCount = 0;
+    uint8_t glyphSpacing = 1;
+    bool valid = false;
+};
+
+} // namespace common
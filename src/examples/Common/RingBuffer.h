@@ -0,0 +1,81 @@
+#pragma once
+#include <cstddef>
+
+namespace common {
+
+/**
+ * @brief Fixed-capacity circular buffer with O(1) push/pop at both ends.
+ *
+ * Elements live in a static array and are never moved: pushing advances a
+ * head or tail index that wraps around, so queues and snake-like bodies grow
+ * at one end and recycle at the other without shifting memory or allocating.
+ * Indexing with operator[] is relative to the front (0 = oldest element).
+ *
+ * Pushing onto a full buffer or popping an empty one is rejected (returns
+ * false) rather than overwriting data; callers check isFull()/isEmpty().
+ */
+template <typename T, std::size_t N>
+class RingBuffer {
+public:
+    static_assert(N > 0, "RingBuffer needs a non-zero capacity");
+
+    /** @brief Appends an element after the current back. */
+    bool pushBack(const T& value) {
+        if (count == N) return false;
+        items[wrap(start + count)] = value;
+        ++count;
+        return true;
+    }
+
+    /** @brief Inserts an element before the current front. */
+    bool pushFront(const T& value) {
+        if (count == N) return false;
+        start = (start == 0) ? N - 1 : start - 1;
+        items[start] = value;
+        ++count;
+        return true;
+    }
+
+    /** @brief Drops the front (oldest) element. */
+    bool popFront() {
+        if (count == 0) return false;
+        start = wrap(start + 1);
+        --count;
+        return true;
+    }
+
+    /** @brief Drops the back (newest) element. */
+    bool popBack() {
+        if (count == 0) return false;
+        --count;
+        return true;
+    }
+
+    T& front() { return items[start]; }
+    const T& front() const { return items[start]; }
+    T& back() { return items[wrap(start + count - 1)]; }
+    const T& back() const { return items[wrap(start + count - 1)]; }
+
+    /** @brief Element at position i counted from the front. No bounds check. */
+    T& operator[](std::size_t i) { return items[wrap(start + i)]; }
+    const T& operator[](std::size_t i) const { return items[wrap(start + i)]; }
+
+    void clear() {
+        start = 0;
+        count = 0;
+    }
+
+    std::size_t size() const { return count; }
+    static constexpr std::size_t capacity() { return N; }
+    bool isEmpty() const { return count == 0; }
+    bool isFull() const { return count == N; }
+
+private:
+    static std::size_t wrap(std::size_t i) { return (i >= N) ? i - N : i; }
+
+    T items[N] = {};
+    std::size_t start = 0;
+    std::size_t count = 0;
+};
+
+} // namespace common
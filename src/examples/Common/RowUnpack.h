@@ -0,0 +1,98 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+
+namespace common {
+
+/**
+ * @brief Byte-to-pixels lookup tables for packed sprite rows.
+ *
+ * Every packed format in the engine is LSB-first: bit 0 (1bpp), bits 0-1
+ * (2bpp) or bits 0-3 (4bpp) of each byte hold its leftmost pixel. One table
+ * lookup therefore expands a whole byte (8, 4 or 2 pixels) into palette
+ * indices, instead of one shift and mask per pixel. The tables are built at
+ * compile time and live in flash (256 * 14 bytes).
+ */
+struct RowUnpackTables {
+    uint8_t bits1[256][8] = {};
+    uint8_t bits2[256][4] = {};
+    uint8_t bits4[256][2] = {};
+
+    constexpr RowUnpackTables() {
+        for (int b = 0; b < 256; ++b) {
+            for (int i = 0; i < 8; ++i) bits1[b][i] = static_cast<uint8_t>((b >> i) & 0x1);
+            for (int i = 0; i < 4; ++i) bits2[b][i] = static_cast<uint8_t>((b >> (i * 2)) & 0x3);
+            for (int i = 0; i < 2; ++i) bits4[b][i] = static_cast<uint8_t>((b >> (i * 4)) & 0xF);
+        }
+    }
+};
+
+inline constexpr RowUnpackTables ROW_UNPACK_TABLES{};
+
+/**
+ * @brief Expands part of a packed row into one palette index per byte.
+ *
+ * Writes the indices of visible columns [first, first + count) of a row that
+ * is @p width pixels wide. With @p flipX the row is mirrored first, so
+ * out[0] is source column width - 1 - first. Index 0 is transparent.
+ *
+ * Whole bytes go through ROW_UNPACK_TABLES. Only the partial bytes at either
+ * end of the range are decoded a pixel at a time, so an unclipped, unflipped
+ * row is a straight run of table copies.
+ *
+ * @param bytes Packed row, LSB-first (the sprite compiler's padded rows work as-is).
+ * @param bpp 1, 2 or 4.
+ */
+inline void unpackRow(const uint8_t* bytes, int bpp, int width, int first, int count,
+                      bool flipX, uint8_t* out) {
+    if (count <= 0) return;
+    const int srcFirst = flipX ? width - first - count : first;
+    const int perByte = 8 / bpp;
+    const uint8_t mask = static_cast<uint8_t>((1u << bpp) - 1);
+
+    int x = srcFirst;
+    const int end = srcFirst + count;
+    uint8_t* dst = out;
+
+    // Leading pixels up to the next byte boundary.
+    while (x < end && (x % perByte) != 0) {
+        const int bit = x * bpp;
+        *dst++ = static_cast<uint8_t>((bytes[bit >> 3] >> (bit & 7)) & mask);
+        ++x;
+    }
+
+    // Whole bytes.
+    const int wholeBytes = (end - x) / perByte;
+    const uint8_t* src = bytes + (x * bpp) / 8;
+    if (bpp == 1) {
+        for (int i = 0; i < wholeBytes; ++i, dst += 8) std::memcpy(dst, ROW_UNPACK_TABLES.bits1[src[i]], 8);
+    } else if (bpp == 2) {
+        for (int i = 0; i < wholeBytes; ++i, dst += 4) std::memcpy(dst, ROW_UNPACK_TABLES.bits2[src[i]], 4);
+    } else {
+        for (int i = 0; i < wholeBytes; ++i, dst += 2) std::memcpy(dst, ROW_UNPACK_TABLES.bits4[src[i]], 2);
+    }
+    x += wholeBytes * perByte;
+
+    // Trailing pixels.
+    while (x < end) {
+        const int bit = x * bpp;
+        *dst++ = static_cast<uint8_t>((bytes[bit >> 3] >> (bit & 7)) & mask);
+        ++x;
+    }
+
+    if (flipX) {
+        for (int i = 0, j = count - 1; i < j; ++i, --j) {
+            const uint8_t t = out[i];
+            out[i] = out[j];
+            out[j] = t;
+        }
+    }
+}
+
+/** @brief unpackRow() for a 1bpp Sprite row (bit 0 = leftmost pixel). */
+inline void unpackRow(uint16_t bits, int width, int first, int count, bool flipX, uint8_t* out) {
+    const uint8_t bytes[2] = { static_cast<uint8_t>(bits & 0xFF), static_cast<uint8_t>(bits >> 8) };
+    unpackRow(bytes, 1, width, first, count, flipX, out);
+}
+
+} // namespace common
@@ -0,0 +1,126 @@
+#pragma once
+#include "graphics/Renderer.h"
+#include "graphics/FontManager.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace common {
+
+/**
+ * @brief Pre-expanded 2x and 3x glyphs for the default font.
+ *
+ * At size 2 or 3, drawText scales every glyph pixel into a size x size block
+ * at draw time. ScaledFont expands each glyph the first time it is drawn at
+ * a given size into an ordinary 1bpp Sprite (a 5x7 glyph becomes 10x14 at 2x
+ * and 15x21 at 3x, still one uint16_t per row). From then on every character
+ * is a plain unscaled drawSprite call.
+ *
+ * Storage is a fixed pool of MaxGlyphs expanded glyphs; glyphs are never
+ * evicted. Once the pool is full, or for sizes whose glyphs would be wider
+ * than 16 pixels, characters are drawn with the renderer's scaled blit
+ * instead. Size 1 text is passed straight to drawText. Changing the default
+ * font empties the pool.
+ */
+template <int MaxGlyphs, int MaxHeight = 21>
+class ScaledFont {
+public:
+    static_assert(MaxGlyphs > 0 && MaxGlyphs <= 127, "ScaledFont slot indices are 8-bit");
+
+    static constexpr int MinSize = 2;
+    static constexpr int MaxSize = 3;
+
+    ScaledFont() { clear(); }
+
+    void clear() {
+        std::memset(slotOf, -1, sizeof(slotOf));
+        used = 0;
+        font = nullptr;
+    }
+
+    /** @brief Drop-in for Renderer::drawText(text, x, y, color, size). */
+    void drawText(pixelroot32::graphics::Renderer& renderer, const char* text, int x, int y,
+                  pixelroot32::graphics::Color color, uint8_t size) {
+        const pixelroot32::graphics::Font* current = pixelroot32::graphics::FontManager::getDefaultFont();
+        if (!current || !text || size < MinSize || size > MaxSize) {
+            renderer.drawText(text, x, y, color, size);
+            return;
+        }
+        if (current != font) {
+            clear();
+            font = current;
+        }
+
+        const int advance = (font->glyphWidth + font->spacing) * size;
+        for (const char* p = text; *p; ++p, x += advance) {
+            const unsigned char c = static_cast<unsigned char>(*p);
+            if (c < font->firstChar || c > font->lastChar) continue;
+            if (const pixelroot32::graphics::Sprite* glyph = acquire(c, size)) {
+                renderer.drawSprite(*glyph, x, y, color);
+            } else {
+                renderer.drawSprite(font->glyphs[c - font->firstChar], x, y,
+                                    static_cast<float>(size), static_cast<float>(size), color);
+            }
+        }
+    }
+
+    /** @brief Drop-in for Renderer::drawTextCentered(text, y, color, size). */
+    void drawTextCentered(pixelroot32::graphics::Renderer& renderer, const char* text, int y,
+                          pixelroot32::graphics::Color color, uint8_t size) {
+        const pixelroot32::graphics::Font* current = pixelroot32::graphics::FontManager::getDefaultFont();
+        if (!current || !text || size < MinSize || size > MaxSize) {
+            renderer.drawTextCentered(text, y, color, size);
+            return;
+        }
+        const int length = static_cast<int>(std::strlen(text));
+        const int width = length > 0 ? length * (current->glyphWidth + current->spacing) * size
+                                           - current->spacing * size
+                                     : 0;
+        drawText(renderer, text, (renderer.getWidth() - width) / 2, y, color, size);
+    }
+
+    /** @brief Glyphs expanded so far (at most MaxGlyphs). */
+    int getExpandedGlyphs() const { return used; }
+
+    /** @brief Static memory reserved for the pool and its index, in bytes. */
+    static constexpr std::size_t getMemoryBytes() { return sizeof(Glyph) * MaxGlyphs + sizeof(slotOf); }
+
+private:
+    struct Glyph {
+        uint16_t rows[MaxHeight];
+        pixelroot32::graphics::Sprite sprite;
+    };
+
+    const pixelroot32::graphics::Sprite* acquire(unsigned char c, int size) {
+        if (c > 0x7F) return nullptr;
+        int8_t& slot = slotOf[size - MinSize][c];
+        if (slot >= 0) return &glyphs[slot].sprite;
+        if (used >= MaxGlyphs) return nullptr;
+        if (font->glyphWidth * size > 16 || font->glyphHeight * size > MaxHeight) return nullptr;
+
+        Glyph& glyph = glyphs[used];
+        const pixelroot32::graphics::Sprite& source = font->glyphs[c - font->firstChar];
+        for (int row = 0; row < font->glyphHeight; ++row) {
+            // Each source bit becomes size adjacent bits, LSB-first like the source.
+            uint16_t bits = 0;
+            for (int gx = 0; gx < font->glyphWidth; ++gx) {
+                if (source.data[row] & (1u << gx)) {
+                    bits = static_cast<uint16_t>(bits | (((1u << size) - 1) << (gx * size)));
+                }
+            }
+            for (int dy = 0; dy < size; ++dy) glyph.rows[row * size + dy] = bits;
+        }
+        glyph.sprite.data = glyph.rows;
+        glyph.sprite.width = static_cast<uint8_t>(font->glyphWidth * size);
+        glyph.sprite.height = static_cast<uint8_t>(font->glyphHeight * size);
+        slot = static_cast<int8_t>(used++);
+        return &glyph.sprite;
+    }
+
+    Glyph glyphs[MaxGlyphs];
+    int8_t slotOf[MaxSize - MinSize + 1][128];
+    const pixelroot32::graphics::Font* font;
+    int used;
+};
+
+} // namespace common
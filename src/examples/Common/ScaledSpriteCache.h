@@ -0,0 +1,168 @@
+#pragma once
+#include "SpriteBatch.h"
+#include <cstddef>
+
+namespace common {
+
+/**
+ * @brief Bounded cache of pre-scaled 1bpp sprites for fractional-scale draws.
+ *
+ * Entries are keyed by source pointer and scale. 1bpp sprites are tinted at
+ * blit time and MultiSprite layers carry their own colors, so the palette is
+ * not part of the key. On a miss the least recently used entry is re-scaled
+ * in place; after that the draw is a plain unscaled blit.
+ *
+ * Entry pointers returned by acquire() stay valid until the next miss.
+ * Sources that do not fit an entry (wider than 16 px once scaled, taller than
+ * MaxHeight, more than MaxLayers layers) fall back to the renderer's scaler.
+ */
+template <int Capacity, int MaxHeight, int MaxLayers = 1>
+class ScaledSpriteCache {
+public:
+    using Entry = SpriteBatch<MaxHeight, MaxLayers>;
+    static_assert(Capacity > 0, "ScaledSpriteCache needs at least one entry");
+
+    ScaledSpriteCache() { clear(); }
+
+    /** @brief Drops every entry and resets the statistics. */
+    void clear() {
+        for (int i = 0; i < Capacity; ++i) {
+            slots[i] = Slot{};
+        }
+        clock = 0;
+        resetStats();
+    }
+
+    /** @brief Pre-scaled entry for a sprite, or nullptr if it cannot be cached. */
+    const Entry* acquire(const pixelroot32::graphics::Sprite& sprite, float scaleX, float scaleY) {
+        return lookup(sprite, scaleX, scaleY, true);
+    }
+
+    const Entry* acquire(const pixelroot32::graphics::MultiSprite& sprite, float scaleX, float scaleY) {
+        return lookup(sprite, scaleX, scaleY, true);
+    }
+
+    /**
+     * @brief Scales a source ahead of time (e.g. from a scene's init()).
+     * Prewarming does not count towards the hit/miss statistics.
+     * @return true if the source is now cached.
+     */
+    bool prewarm(const pixelroot32::graphics::Sprite& sprite, float scaleX, float scaleY) {
+        return lookup(sprite, scaleX, scaleY, false) != nullptr;
+    }
+
+    bool prewarm(const pixelroot32::graphics::MultiSprite& sprite, float scaleX, float scaleY) {
+        return lookup(sprite, scaleX, scaleY, false) != nullptr;
+    }
+
+    /**
+     * @brief The entry a draw would use, without counting a lookup, changing
+     * the LRU order or scaling on a miss; nullptr if the source is not cached.
+     */
+    template <typename SpriteT>
+    const Entry* find(const SpriteT& sprite, float scaleX, float scaleY) const {
+        for (int i = 0; i < Capacity; ++i) {
+            const Slot& slot = slots[i];
+            if (slot.used && slot.entry.getSource() == &sprite && slot.scaleX == scaleX && slot.scaleY == scaleY) {
+                return slot.entry.isPrepared() ? &slot.entry : nullptr;
+            }
+        }
+        return nullptr;
+    }
+
+    /** @brief Drop-in for Renderer::drawSprite(sprite, x, y, scaleX, scaleY, color, flipX). */
+    void drawSprite(pixelroot32::graphics::Renderer& renderer, const pixelroot32::graphics::Sprite& sprite,
+                    int x, int y, float scaleX, float scaleY,
+                    pixelroot32::graphics::Color color, bool flipX = false) {
+        if (const Entry* entry = acquire(sprite, scaleX, scaleY)) {
+            const SpriteInstance instance = { static_cast<int16_t>(x), static_cast<int16_t>(y), flipX };
+            entry->draw(renderer, &instance, 1, color);
+        } else {
+            renderer.drawSprite(sprite, x, y, scaleX, scaleY, color, flipX);
+        }
+    }
+
+    /** @brief Drop-in for Renderer::drawMultiSprite(sprite, x, y, scaleX, scaleY). */
+    void drawMultiSprite(pixelroot32::graphics::Renderer& renderer, const pixelroot32::graphics::MultiSprite& sprite,
+                         int x, int y, float scaleX, float scaleY) {
+        if (const Entry* entry = acquire(sprite, scaleX, scaleY)) {
+            const SpriteInstance instance = { static_cast<int16_t>(x), static_cast<int16_t>(y), false };
+            entry->draw(renderer, &instance, 1, pixelroot32::graphics::Color::White);
+        } else {
+            renderer.drawMultiSprite(sprite, x, y, scaleX, scaleY);
+        }
+    }
+
+    unsigned long getHits() const { return hits; }
+    unsigned long getMisses() const { return misses; }
+
+    /** @brief Hits as a percentage of all counted lookups (0 when nothing was counted). */
+    int getHitRatePercent() const {
+        const unsigned long total = hits + misses;
+        return total ? static_cast<int>((hits * 100UL) / total) : 0;
+    }
+
+    /** @brief Entries currently holding a scaled bitmap. */
+    int getUsedEntries() const {
+        int used = 0;
+        for (int i = 0; i < Capacity; ++i) {
+            if (slots[i].entry.isPrepared()) ++used;
+        }
+        return used;
+    }
+
+    /** @brief Static memory reserved by the cache, in bytes. */
+    static constexpr std::size_t getMemoryBytes() { return sizeof(Slot) * Capacity; }
+
+    void resetStats() {
+        hits = 0;
+        misses = 0;
+    }
+
+private:
+    struct Slot {
+        Entry entry;
+        float scaleX = 0.0f;
+        float scaleY = 0.0f;
+        unsigned long lastUse = 0;
+        bool used = false;
+    };
+
+    template <typename SpriteT>
+    const Entry* lookup(const SpriteT& sprite, float scaleX, float scaleY, bool countStats) {
+        ++clock;
+
+        int victim = 0;
+        for (int i = 0; i < Capacity; ++i) {
+            Slot& slot = slots[i];
+            if (slot.used && slot.entry.getSource() == &sprite &&
+                slot.scaleX == scaleX && slot.scaleY == scaleY) {
+                slot.lastUse = clock;
+                // A remembered rejection: skip re-scaling and let the caller fall back.
+                if (!slot.entry.isPrepared()) return nullptr;
+                if (countStats) ++hits;
+                return &slot.entry;
+            }
+            if (!slot.used) {
+                if (slots[victim].used) victim = i;
+            } else if (slots[victim].used && slot.lastUse < slots[victim].lastUse) {
+                victim = i;
+            }
+        }
+
+        if (countStats) ++misses;
+        Slot& slot = slots[victim];
+        slot.used = true;
+        slot.scaleX = scaleX;
+        slot.scaleY = scaleY;
+        slot.lastUse = clock;
+        return slot.entry.prepare(sprite, scaleX, scaleY) ? &slot.entry : nullptr;
+    }
+
+    Slot slots[Capacity];
+    unsigned long clock;
+    unsigned long hits;
+    unsigned long misses;
+};
+
+} // namespace common
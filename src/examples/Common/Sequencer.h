@@ -0,0 +1,281 @@
+#pragma once
+#include "audio/AudioMusicTypes.h"
+#include "PackedMusic.h"
+#include <cstdint>
+
+namespace common {
+
+/** @brief Frequency of a MusicNote pitch, A4 = 440 Hz; 0 for rests. */
+inline float noteFrequency(pixelroot32::audio::Note note, uint8_t octave) {
+    // Octave 4, C to B.
+    static const float OCTAVE_4[12] = {
+        261.63f, 277.18f, 293.66f, 311.13f, 329.63f, 349.23f,
+        369.99f, 392.00f, 415.30f, 440.00f, 466.16f, 493.88f
+    };
+    const int index = static_cast<int>(note);
+    if (index < 0 || index >= 12) return 0.0f;
+    float frequency = OCTAVE_4[index];
+    for (int o = octave; o > 4; --o) frequency *= 2.0f;
+    for (int o = octave; o < 4; ++o) frequency *= 0.5f;
+    return frequency;
+}
+
+/**
+ * @brief How far note starts land from their score position.
+ *
+ * Lateness is in output samples, 16.16 fixed point: the score time that had
+ * already passed when a note started, at the tempo of that moment. The first
+ * note of each track starts with it and is not counted.
+ */
+struct OnsetStats {
+    unsigned long onsets = 0;
+    uint64_t lateTotal = 0;
+    uint32_t lateWorst = 0;
+};
+
+/**
+ * @brief Plays several MusicTracks at once on one sample clock.
+ *
+ * Where a MusicPlayer advances its notes from each frame's deltaTime (so a
+ * note starts on the first frame after it is due, and two players drift
+ * apart), the sequencer keeps its clock in the output: render() splits each
+ * request at the exact sample where a track's next note is due, renders the
+ * mixer up to it and starts the note there. Each track's position is a
+ * 48.16 fixed-point count of score samples, and the remainder carries from
+ * note to note, so tracks never drift against each other or the audio.
+ *
+ * Tracks are either MusicTrack tables or tracks of a PackedSong, which are
+ * decoded one note at a time as they come due. getOnsetStats() reports how
+ * far each start landed from its score position.
+ *
+ * The tempo factor scales how fast score time passes per output sample.
+ * setTempoFactor() can glide to a new tempo; during the glide the tempo
+ * steps every GlideSpan samples, so there is no audible jump.
+ *
+ * Mixer is any type with play(const AudioEvent&, uint8_t priority),
+ * render(int16_t*, int) and getSampleRate(), such as FixedMixer.
+ */
+template <typename Mixer, int MaxTracks = 4>
+class Sequencer {
+public:
+    static constexpr int GlideSpan = 32;  // Samples between tempo steps while gliding
+
+    explicit Sequencer(Mixer& mixer) : mixer(mixer) { clear(); }
+
+    /** @brief Removes every track and stops. */
+    void clear() {
+        trackCount = 0;
+        playing = false;
+        tempo = One;
+        targetTempo = One;
+        tempoStep = 0;
+        clock = 0;
+    }
+
+    /**
+     * @brief Adds a track; every track starts together at the next start().
+     * @param priority Voice priority for the track's notes (see FixedMixer::play()).
+     * @return false if MaxTracks tracks are already set.
+     */
+    bool addTrack(const pixelroot32::audio::MusicTrack& track, uint8_t priority = 1) {
+        if (trackCount >= MaxTracks || !track.notes || track.count == 0) return false;
+        Track& slot = tracks[trackCount++];
+        slot = Track{};
+        slot.track = &track;
+        slot.channelType = track.channelType;
+        slot.duty = track.duty;
+        slot.priority = priority;
+        return true;
+    }
+
+    /** @brief Adds track @p index of a packed song, streamed as it plays. */
+    bool addTrack(const PackedSong& song, int index, uint8_t priority = 1) {
+        if (trackCount >= MaxTracks || index < 0 || index >= song.trackCount) return false;
+        Track& slot = tracks[trackCount++];
+        slot = Track{};
+        slot.song = &song;
+        slot.songTrack = static_cast<uint8_t>(index);
+        slot.channelType = song.tracks[index].channelType;
+        slot.duty = song.tracks[index].duty;
+        slot.priority = priority;
+        return true;
+    }
+
+    /** @brief Starts every track from its first note, on the next rendered sample. */
+    void start() {
+        for (int i = 0; i < trackCount; ++i) {
+            Track& track = tracks[i];
+            track.index = 0;
+            track.notesStarted = 0;
+            track.remaining = 0;
+            track.active = true;
+            if (track.song) track.reader.begin(*track.song, track.songTrack);
+        }
+        clock = 0;
+        playing = trackCount > 0;
+    }
+
+    /** @brief Stops starting notes; notes already playing run out in the mixer. */
+    void stop() { playing = false; }
+
+    bool isPlaying() const { return playing; }
+
+    /**
+     * @brief Sets the tempo factor (1.0 = as written).
+     * @param glideSeconds Time to reach it; 0 changes it at the next sample.
+     */
+    void setTempoFactor(float factor, float glideSeconds = 0.0f) {
+        if (factor < 0.05f) factor = 0.05f;
+        targetTempo = static_cast<uint32_t>(factor * One);
+        const float glideSamples = glideSeconds * static_cast<float>(mixer.getSampleRate());
+        if (glideSamples < 1.0f) {
+            tempo = targetTempo;
+            tempoStep = 0;
+            return;
+        }
+        const uint32_t distance = targetTempo > tempo ? targetTempo - tempo : tempo - targetTempo;
+        tempoStep = static_cast<uint32_t>(static_cast<float>(distance) / glideSamples * GlideSpan);
+        if (tempoStep == 0) tempoStep = 1;
+    }
+
+    /** @brief Current tempo factor, part-way through a glide if one is running. */
+    float getTempoFactor() const { return static_cast<float>(tempo) / One; }
+
+    /** @brief Output samples rendered since start(). */
+    uint64_t getSampleClock() const { return clock; }
+
+    int getTrackCount() const { return trackCount; }
+
+    /** @brief Notes and rests a track has started since start(). */
+    unsigned long getNotesStarted(int track) const {
+        return track >= 0 && track < trackCount ? tracks[track].notesStarted : 0;
+    }
+
+    const OnsetStats& getOnsetStats() const { return onsetStats; }
+    void resetOnsetStats() { onsetStats = OnsetStats{}; }
+
+    /** @brief Renders @p frames samples, starting notes on the sample they are due. */
+    void render(int16_t* out, int frames) {
+        while (frames > 0) {
+            if (playing) triggerDueNotes();
+
+            int span = frames;
+            if (tempo != targetTempo && span > GlideSpan) span = GlideSpan;
+            if (playing) {
+                for (int i = 0; i < trackCount; ++i) {
+                    const Track& track = tracks[i];
+                    if (!track.active) continue;
+                    // Output samples until this track's note is due, rounded up.
+                    const int64_t due = (track.remaining + tempo - 1) / tempo;
+                    if (due < span) span = static_cast<int>(due);
+                }
+            }
+            if (span < 1) span = 1;
+
+            mixer.render(out, span);
+            out += span;
+            frames -= span;
+            clock += static_cast<uint64_t>(span);
+
+            if (playing) {
+                const int64_t elapsed = static_cast<int64_t>(tempo) * span;
+                for (int i = 0; i < trackCount; ++i) {
+                    if (tracks[i].active) tracks[i].remaining -= elapsed;
+                }
+            }
+            stepTempo(span);
+        }
+    }
+
+private:
+    static constexpr uint32_t One = 65536;  // Tempo factor 1.0, and one score sample, in 16.16
+
+    struct Track {
+        const pixelroot32::audio::MusicTrack* track = nullptr;  // Table source, or
+        const PackedSong* song = nullptr;                       // packed source
+        PackedTrackReader reader;
+        pixelroot32::audio::WaveType channelType = pixelroot32::audio::WaveType::PULSE;
+        float duty = 0.5f;
+        int64_t remaining = 0;  // Score samples (16.16) until the next note
+        unsigned long notesStarted = 0;
+        uint16_t index = 0;     // Next note of a table track
+        uint8_t songTrack = 0;
+        uint8_t priority = 1;
+        bool active = false;
+    };
+
+    static bool nextNote(Track& track, pixelroot32::audio::MusicNote& note) {
+        if (track.song) return track.reader.next(note);
+        if (track.index >= track.track->count) {
+            if (!track.track->loop) return false;
+            track.index = 0;
+        }
+        note = track.track->notes[track.index++];
+        return true;
+    }
+
+    void triggerDueNotes() {
+        bool anyActive = false;
+        for (int i = 0; i < trackCount; ++i) {
+            Track& track = tracks[i];
+            while (track.active && track.remaining <= 0) {
+                pixelroot32::audio::MusicNote note;
+                if (!nextNote(track, note)) {
+                    track.active = false;
+                    break;
+                }
+                ++track.notesStarted;
+                // remaining is the (non-positive) score position of this
+                // start relative to where the note was written.
+                if (track.notesStarted > 1) recordOnset(-track.remaining);
+                const int64_t length = static_cast<int64_t>(
+                    static_cast<double>(note.duration) * mixer.getSampleRate() * One);
+                // Zero-length notes would never advance the clock; treat them as one sample.
+                track.remaining += length > 0 ? length : One;
+
+                const float frequency = noteFrequency(note.note, note.octave);
+                if (frequency > 0.0f) {
+                    pixelroot32::audio::AudioEvent event{};
+                    event.type = track.channelType;
+                    event.frequency = frequency;
+                    event.duration = note.duration * One / static_cast<float>(tempo);
+                    event.volume = note.volume;
+                    event.duty = track.duty;
+                    mixer.play(event, track.priority);
+                }
+            }
+            anyActive = anyActive || track.active;
+        }
+        playing = anyActive;
+    }
+
+    void recordOnset(int64_t overshoot) {
+        const uint32_t late = static_cast<uint32_t>((static_cast<uint64_t>(overshoot) << 16) / tempo);
+        ++onsetStats.onsets;
+        onsetStats.lateTotal += late;
+        if (late > onsetStats.lateWorst) onsetStats.lateWorst = late;
+    }
+
+    void stepTempo(int span) {
+        if (tempo == targetTempo) return;
+        const uint32_t step = static_cast<uint32_t>((static_cast<uint64_t>(tempoStep) * span) / GlideSpan);
+        const uint32_t move = step > 0 ? step : 1;
+        if (tempo < targetTempo) {
+            tempo = targetTempo - tempo <= move ? targetTempo : tempo + move;
+        } else {
+            tempo = tempo - targetTempo <= move ? targetTempo : tempo - move;
+        }
+    }
+
+    Mixer& mixer;
+    Track tracks[MaxTracks];
+    int trackCount;
+    bool playing;
+    uint32_t tempo;        // 16.16
+    uint32_t targetTempo;  // 16.16
+    uint32_t tempoStep;    // 16.16 per GlideSpan samples
+    uint64_t clock;
+    OnsetStats onsetStats;
+};
+
+} // namespace common
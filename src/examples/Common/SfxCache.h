@@ -0,0 +1,124 @@
+#pragma once
+#include "audio/AudioTypes.h"
+#include "FixedMixer.h"
+#include <cstdint>
+
+namespace common {
+
+/**
+ * @brief Pre-rendered 8-bit PCM for AudioEvents that never change.
+ *
+ * Constant sound effects (BrickBreaker's PADDLE_HIT, WALL_HIT, BRICK_HIT,
+ * the Space Invaders shot) are synthesized from scratch on every play.
+ * prerender() runs the synthesis once, at scene init, into a BudgetBytes
+ * pool: one signed byte per sample at full scale, so an event costs
+ * duration * sampleRate bytes. play() then starts a FixedMixer sample voice
+ * for a cached event, which only reads and scales bytes, and falls back to
+ * live synthesis for everything else.
+ *
+ * Volume is applied at playback, so one entry serves an event at any
+ * volume. Entries are keyed on waveform, frequency, duration and duty; an
+ * event that does not fit the remaining budget is refused and stays live.
+ * Render at the rate of the mixer that plays the samples.
+ */
+template <int BudgetBytes, int MaxEntries = 8>
+class SfxCache {
+public:
+    /**
+     * @brief Renders @p event into the pool.
+     * @return false if the cache is full or over budget (the event stays live).
+     */
+    bool prerender(const pixelroot32::audio::AudioEvent& event, int sampleRate) {
+        if (find(event)) return true;
+        const long frames = static_cast<long>(event.duration * static_cast<float>(sampleRate));
+        if (entryCount >= MaxEntries || frames <= 0 || used + frames > BudgetBytes) {
+            ++refused;
+            return false;
+        }
+
+        // Full volume, alone on the mixer: +-VoiceFullScale, scaled to +-127 below.
+        FixedMixer<1, RenderBlock> synth(sampleRate);
+        pixelroot32::audio::AudioEvent loud = event;
+        loud.volume = 1.0f;
+        synth.play(loud);
+
+        int8_t* out = pool + used;
+        int16_t block[RenderBlock];
+        for (long done = 0; done < frames; done += RenderBlock) {
+            const int count = frames - done < RenderBlock ? static_cast<int>(frames - done) : RenderBlock;
+            synth.render(block, count);
+            for (int i = 0; i < count; ++i) {
+                const int32_t s = (static_cast<int32_t>(block[i]) * 127) / FixedMixer<1>::VoiceFullScale;
+                out[done + i] = static_cast<int8_t>(s > 127 ? 127 : (s < -127 ? -127 : s));
+            }
+        }
+
+        entries[entryCount++] = { event, out, static_cast<uint32_t>(frames) };
+        used += static_cast<int>(frames);
+        return true;
+    }
+
+    /**
+     * @brief Plays @p event from the cache if it was pre-rendered, live otherwise.
+     * @return false if the mixer dropped it.
+     */
+    template <typename Mixer>
+    bool play(Mixer& mixer, const pixelroot32::audio::AudioEvent& event, uint8_t priority = 0) {
+        if (const Entry* entry = find(event)) {
+            ++cachedPlays;
+            return mixer.playSample(entry->pcm, entry->frames, event, priority);
+        }
+        ++livePlays;
+        return mixer.play(event, priority);
+    }
+
+    bool contains(const pixelroot32::audio::AudioEvent& event) const { return find(event) != nullptr; }
+
+    /** @brief Removes every entry and frees the pool. */
+    void clear() {
+        entryCount = 0;
+        used = 0;
+    }
+
+    int getEntryCount() const { return entryCount; }
+    int getUsedBytes() const { return used; }
+    static constexpr int getBudgetBytes() { return BudgetBytes; }
+    int getRefusedCount() const { return refused; }
+    unsigned long getCachedPlays() const { return cachedPlays; }
+    unsigned long getLivePlays() const { return livePlays; }
+
+    void resetPlayCounts() {
+        cachedPlays = 0;
+        livePlays = 0;
+    }
+
+private:
+    static constexpr int RenderBlock = 128;
+
+    struct Entry {
+        pixelroot32::audio::AudioEvent event;
+        const int8_t* pcm;
+        uint32_t frames;
+    };
+
+    const Entry* find(const pixelroot32::audio::AudioEvent& event) const {
+        for (int i = 0; i < entryCount; ++i) {
+            const pixelroot32::audio::AudioEvent& key = entries[i].event;
+            if (key.type == event.type && key.frequency == event.frequency && key.duration == event.duration &&
+                key.duty == event.duty) {
+                return &entries[i];
+            }
+        }
+        return nullptr;
+    }
+
+    int8_t pool[BudgetBytes];
+    Entry entries[MaxEntries];
+    int entryCount = 0;
+    int used = 0;
+    int refused = 0;
+    unsigned long cachedPlays = 0;
+    unsigned long livePlays = 0;
+};
+
+} // namespace common
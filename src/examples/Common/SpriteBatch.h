@@ -0,0 +1,189 @@
+#pragma once
+#include "graphics/Renderer.h"
+#include "FlatSprite.h"
+#include <cstdint>
+
+namespace common {
+
+/** @brief One on-screen copy of a batched sprite. */
+struct SpriteInstance {
+    int16_t x;
+    int16_t y;
+    bool flipX;
+};
+
+/**
+ * @brief Draws many instances of one 1bpp Sprite or MultiSprite at a fixed scale.
+ *
+ * prepare() runs the nearest-neighbour scaler once and stores the scaled rows
+ * (plus a mirrored copy for flipX) in a small scratch buffer. draw() then
+ * issues plain unscaled blits for every instance, so the per-pixel float
+ * scaling is paid once per source instead of once per instance per frame.
+ *
+ * Scaled rows are stored as 1bpp uint16_t rows, so the scaled width is capped
+ * at 16 pixels. MaxHeight and MaxLayers bound the scratch buffer.
+ *
+ * With 2bpp sprites enabled, scaled MultiSprite layers are also flattened
+ * into one indexed bitmap (see FlatSprite), so every instance is a single
+ * indexed blit instead of one pass per layer. Debug-overlay builds validate
+ * the flattened bitmap against the layers and keep the layered draw if they
+ * differ.
+ */
+template <int MaxHeight, int MaxLayers = 1>
+class SpriteBatch {
+public:
+    static constexpr int MaxWidth = 16;
+    static_assert(MaxHeight > 0 && MaxHeight <= 255, "SpriteBatch height must fit in a Sprite");
+    static_assert(MaxLayers > 0, "SpriteBatch needs at least one layer");
+
+    SpriteBatch() : source(nullptr), layerCount(0), width(0), height(0), multi(false), flattened(false) {}
+
+    /** @brief Pre-scales a single-layer sprite. Returns false if it does not fit. */
+    bool prepare(const pixelroot32::graphics::Sprite& sprite, float scaleX, float scaleY) {
+        source = &sprite;
+        multi = false;
+        if (!fit(sprite.width, sprite.height, scaleX, scaleY)) return false;
+        layerCount = 1;
+        scaleLayer(0, sprite.data, sprite.width, sprite.height, scaleX, scaleY,
+                   pixelroot32::graphics::Color::White);
+        return true;
+    }
+
+    /** @brief Pre-scales every layer of a MultiSprite. Returns false if it does not fit. */
+    bool prepare(const pixelroot32::graphics::MultiSprite& sprite, float scaleX, float scaleY) {
+        source = &sprite;
+        multi = true;
+        if (sprite.layerCount > MaxLayers || !fit(sprite.width, sprite.height, scaleX, scaleY)) return false;
+        layerCount = sprite.layerCount;
+        for (int i = 0; i < layerCount; ++i) {
+            scaleLayer(i, sprite.layers[i].data, sprite.width, sprite.height, scaleX, scaleY,
+                       sprite.layers[i].color);
+        }
+        flatten();
+        return true;
+    }
+
+    /** @brief The Sprite or MultiSprite last passed to prepare(), or nullptr. */
+    const void* getSource() const { return source; }
+    bool isPrepared() const { return layerCount > 0; }
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+
+    /**
+     * @brief Blits every instance with the pre-scaled bitmap.
+     * @param color Tint for single-layer sprites; MultiSprite layers keep their own colors.
+     */
+    void draw(pixelroot32::graphics::Renderer& renderer, const SpriteInstance* instances, int count,
+              pixelroot32::graphics::Color color) const {
+        if (layerCount == 0) return;
+
+        if (!multi) {
+            for (int i = 0; i < count; ++i) {
+                const SpriteInstance& inst = instances[i];
+                renderer.drawSprite(sprites[inst.flipX ? 1 : 0][0], inst.x, inst.y, color);
+            }
+            return;
+        }
+
+#ifdef PIXELROOT32_ENABLE_2BPP_SPRITES
+        if (flattened) {
+            for (int i = 0; i < count; ++i) {
+                const SpriteInstance& inst = instances[i];
+                flat[inst.flipX ? 1 : 0].draw(renderer, inst.x, inst.y);
+            }
+            return;
+        }
+#endif
+
+        for (int i = 0; i < count; ++i) {
+            const SpriteInstance& inst = instances[i];
+            renderer.drawMultiSprite(multiSprites[inst.flipX ? 1 : 0], inst.x, inst.y);
+        }
+    }
+
+    /** @brief True when MultiSprite instances are drawn from a flattened indexed bitmap. */
+    bool isFlattened() const { return flattened; }
+
+private:
+    // Both orientations are flattened separately: flipping a padded indexed row
+    // in the renderer would shift the sprite by the padding.
+    void flatten() {
+        flattened = false;
+#ifdef PIXELROOT32_ENABLE_2BPP_SPRITES
+        for (int f = 0; f < 2; ++f) {
+            const uint16_t* layerRows[MaxLayers];
+            pixelroot32::graphics::Color layerColors[MaxLayers];
+            for (int i = 0; i < layerCount; ++i) {
+                layerRows[i] = rows[f][i];
+                layerColors[i] = layers[f][i].color;
+            }
+            if (!flat[f].build(layerRows, layerColors, layerCount, width, height)) return;
+#ifdef PIXELROOT32_ENABLE_DEBUG_OVERLAY
+            if (flat[f].countMismatches(multiSprites[f]) != 0) return;
+#endif
+        }
+        flattened = true;
+#endif
+    }
+
+    // Scaled size uses the same "+0.99 then truncate" ceil as the game constants.
+    bool fit(int srcWidth, int srcHeight, float scaleX, float scaleY) {
+        layerCount = 0;
+        flattened = false;
+        width = static_cast<int>(srcWidth * scaleX + 0.99f);
+        height = static_cast<int>(srcHeight * scaleY + 0.99f);
+        return srcWidth > 0 && srcHeight > 0 &&
+               width > 0 && width <= MaxWidth && height > 0 && height <= MaxHeight;
+    }
+
+    void scaleLayer(int layer, const uint16_t* src, int srcWidth, int srcHeight,
+                    float scaleX, float scaleY, pixelroot32::graphics::Color color) {
+        uint16_t* normal = rows[0][layer];
+        uint16_t* mirrored = rows[1][layer];
+
+        for (int dy = 0; dy < height; ++dy) {
+            int sy = static_cast<int>(dy / scaleY);
+            if (sy >= srcHeight) sy = srcHeight - 1;
+            const uint16_t srcRow = src[sy];
+
+            uint16_t out = 0;
+            uint16_t outMirrored = 0;
+            for (int dx = 0; dx < width; ++dx) {
+                int sx = static_cast<int>(dx / scaleX);
+                if (sx >= srcWidth) sx = srcWidth - 1;
+                if (srcRow & (1u << sx)) {
+                    out |= static_cast<uint16_t>(1u << dx);
+                    outMirrored |= static_cast<uint16_t>(1u << (width - 1 - dx));
+                }
+            }
+            normal[dy] = out;
+            mirrored[dy] = outMirrored;
+        }
+
+        const uint8_t w = static_cast<uint8_t>(width);
+        const uint8_t h = static_cast<uint8_t>(height);
+        for (int f = 0; f < 2; ++f) {
+            sprites[f][layer] = { rows[f][layer], w, h };
+            layers[f][layer] = { rows[f][layer], color };
+            multiSprites[f] = { w, h, layers[f], static_cast<uint8_t>(layer + 1) };
+        }
+    }
+
+    const void* source;
+    int layerCount;
+    int width;
+    int height;
+    bool multi;
+    bool flattened;
+
+    // [0] = as authored, [1] = mirrored for flipX.
+    uint16_t rows[2][MaxLayers][MaxHeight] = {};
+    pixelroot32::graphics::Sprite sprites[2][MaxLayers] = {};
+    pixelroot32::graphics::SpriteLayer layers[2][MaxLayers] = {};
+    pixelroot32::graphics::MultiSprite multiSprites[2] = {};
+#ifdef PIXELROOT32_ENABLE_2BPP_SPRITES
+    FlatSprite<MaxWidth, MaxHeight> flat[2];
+#endif
+};
+
+} // namespace common
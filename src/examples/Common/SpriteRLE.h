@@ -0,0 +1,181 @@
+#pragma once
+#include "graphics/Renderer.h"
+#include "RowUnpack.h"
+#include <cstdint>
+
+namespace common {
+
+/** @brief A horizontal run of opaque pixels sharing one palette index. */
+struct SpriteSpan {
+    uint8_t x;
+    uint8_t length;
+    uint8_t colorIndex;  // Index into SpriteRLE::palette; unused for 1bpp sources
+};
+
+/**
+ * @brief Span-encoded sprite: only the opaque runs of each row are stored.
+ *
+ * The spans of row y are spans[rowStart[y]] .. spans[rowStart[y + 1] - 1].
+ * palette is nullptr for 1bpp sources, which take their color from the
+ * draw call like Renderer::drawSprite(const Sprite&, ...).
+ */
+struct SpriteRLE {
+    const SpriteSpan* spans;
+    const uint16_t* rowStart;  // height + 1 entries
+    const pixelroot32::graphics::Color* palette;
+    uint8_t width;
+    uint8_t height;
+};
+
+/**
+ * @brief Draws a span-encoded sprite: one filled 1-pixel-high rectangle per span.
+ *
+ * Transparent pixels cost nothing, so mostly-empty sprites (explosions,
+ * outlines, sparse invaders) skip the per-pixel bit test of the bitmap
+ * blitters. Rows and spans are clipped against the renderer's logical size
+ * before drawing. Clipping therefore assumes screen-space coordinates, i.e.
+ * no display offset.
+ *
+ * @param color Color for 1bpp sources; ignored when the sprite has a palette.
+ */
+inline void drawSprite(pixelroot32::graphics::Renderer& renderer, const SpriteRLE& sprite,
+                       int x, int y, pixelroot32::graphics::Color color, bool flipX = false) {
+    const int clipW = renderer.getWidth();
+    const int clipH = renderer.getHeight();
+    if (x >= clipW || y >= clipH || x + sprite.width <= 0 || y + sprite.height <= 0) return;
+
+    int firstRow = (y < 0) ? -y : 0;
+    int lastRow = sprite.height;
+    if (y + lastRow > clipH) lastRow = clipH - y;
+
+    for (int row = firstRow; row < lastRow; ++row) {
+        const int py = y + row;
+        for (int i = sprite.rowStart[row]; i < sprite.rowStart[row + 1]; ++i) {
+            const SpriteSpan& span = sprite.spans[i];
+            int px = flipX ? x + sprite.width - span.x - span.length : x + span.x;
+            int len = span.length;
+            if (px < 0) {
+                len += px;
+                px = 0;
+            }
+            if (px + len > clipW) len = clipW - px;
+            if (len <= 0) continue;
+
+            renderer.drawFilledRectangle(px, py, len, 1,
+                                         sprite.palette ? sprite.palette[span.colorIndex] : color);
+        }
+    }
+}
+
+/**
+ * @brief Owns the storage for a SpriteRLE and converts bitmaps into it at init.
+ *
+ * MaxSpans bounds the total opaque runs and MaxHeight the rows. build()
+ * returns false if the source does not fit, in which case the caller keeps
+ * drawing the bitmap.
+ */
+template <int MaxSpans, int MaxHeight>
+class SpriteRLEBuffer {
+public:
+    static_assert(MaxSpans > 0 && MaxSpans <= 0xFFFF, "SpriteRLEBuffer span indices are 16-bit");
+    static_assert(MaxHeight > 0 && MaxHeight <= 255, "SpriteRLEBuffer height must fit in a sprite");
+
+    /** @brief Encodes a 1bpp sprite (bit 0 = leftmost pixel). */
+    bool build(const pixelroot32::graphics::Sprite& source) {
+        if (!begin(source.width, source.height, nullptr) || source.width > 16) return fail();
+        uint8_t indices[255];
+        for (int row = 0; row < source.height; ++row) {
+            unpackRow(source.data[row], source.width, 0, source.width, false, indices);
+            if (!encodeRow(row, indices, source.width)) return fail();
+        }
+        return true;
+    }
+
+#ifdef PIXELROOT32_ENABLE_2BPP_SPRITES
+    /** @brief Encodes a 2bpp sprite; index 0 is transparent. */
+    bool build(const pixelroot32::graphics::Sprite2bpp& source) {
+        return buildIndexed(source.data, source.palette, source.width, source.height, 2);
+    }
+#endif
+
+#ifdef PIXELROOT32_ENABLE_4BPP_SPRITES
+    /** @brief Encodes a 4bpp sprite; index 0 is transparent. */
+    bool build(const pixelroot32::graphics::Sprite4bpp& source) {
+        return buildIndexed(source.data, source.palette, source.width, source.height, 4);
+    }
+#endif
+
+    bool isValid() const { return valid; }
+    int getSpanCount() const { return spanCount; }
+
+    /** @brief The encoded sprite; only meaningful while isValid(). */
+    const SpriteRLE& get() const { return sprite; }
+
+private:
+    // Indexed rows are packed LSB-first and padded to whole 16-bit words.
+    bool buildIndexed(const uint8_t* data, const pixelroot32::graphics::Color* palette,
+                      int width, int height, int bpp) {
+        if (!begin(width, height, palette)) return false;
+        const int stride = ((width * bpp + 15) / 16) * 2;
+        uint8_t indices[255];
+        for (int row = 0; row < height; ++row) {
+            unpackRow(data + row * stride, bpp, width, 0, width, false, indices);
+            if (!encodeRow(row, indices, width)) return fail();
+        }
+        return true;
+    }
+
+    bool encodeRow(int row, const uint8_t* indices, int width) {
+        for (int px = 0; px < width; ++px) {
+            if (!emit(px, indices[px])) return false;
+        }
+        endRow(row);
+        return true;
+    }
+
+    bool begin(int width, int height, const pixelroot32::graphics::Color* palette) {
+        valid = false;
+        spanCount = 0;
+        open = false;
+        if (width <= 0 || width > 255 || height <= 0 || height > MaxHeight) return false;
+        sprite = { spans, rowStart, palette, static_cast<uint8_t>(width), static_cast<uint8_t>(height) };
+        rowStart[0] = 0;
+        valid = true;
+        return true;
+    }
+
+    // Extends the open span or starts a new one; index 0 closes it.
+    bool emit(int px, uint8_t index) {
+        if (index == 0) {
+            open = false;
+            return true;
+        }
+        if (open && spans[spanCount - 1].colorIndex == index) {
+            ++spans[spanCount - 1].length;
+            return true;
+        }
+        if (spanCount >= MaxSpans) return false;
+        spans[spanCount++] = { static_cast<uint8_t>(px), 1, index };
+        open = true;
+        return true;
+    }
+
+    void endRow(int row) {
+        open = false;
+        rowStart[row + 1] = static_cast<uint16_t>(spanCount);
+    }
+
+    bool fail() {
+        valid = false;
+        return false;
+    }
+
+    SpriteSpan spans[MaxSpans] = {};
+    uint16_t rowStart[MaxHeight + 1] = {};
+    SpriteRLE sprite = {};
+    int spanCount = 0;
+    bool open = false;
+    bool valid = false;
+};
+
+} // namespace common
@@ -0,0 +1,76 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+namespace common {
+
+/**
+ * @brief Lock-free single-producer/single-consumer ring buffer.
+ *
+ * One thread (or core) only writes, another only reads; neither blocks.
+ * head and tail are free-running counters: the producer owns tail, the
+ * consumer owns head, and each publishes with a release store that the other
+ * side reads with an acquire load. Capacity must be a power of two so the
+ * counters can wrap freely and be masked into the array.
+ */
+template <typename T, int Capacity>
+class SpscRing {
+public:
+    static_assert(Capacity > 1 && (Capacity & (Capacity - 1)) == 0, "SpscRing capacity must be a power of two");
+
+    /** @brief Producer side. @return false if the ring is full. */
+    bool push(const T& item) {
+        const uint32_t tail = this->tail.load(std::memory_order_relaxed);
+        if (tail - head.load(std::memory_order_acquire) >= static_cast<uint32_t>(Capacity)) return false;
+        items[tail & Mask] = item;
+        this->tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** @brief Consumer side. @return false if the ring is empty. */
+    bool pop(T& item) {
+        const uint32_t head = this->head.load(std::memory_order_relaxed);
+        if (head == tail.load(std::memory_order_acquire)) return false;
+        item = items[head & Mask];
+        this->head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** @brief Producer side: copies up to @p count items. @return items written. */
+    int write(const T* source, int count) {
+        const uint32_t tail = this->tail.load(std::memory_order_relaxed);
+        const int space = Capacity - static_cast<int>(tail - head.load(std::memory_order_acquire));
+        if (count > space) count = space;
+        for (int i = 0; i < count; ++i) items[(tail + static_cast<uint32_t>(i)) & Mask] = source[i];
+        this->tail.store(tail + static_cast<uint32_t>(count), std::memory_order_release);
+        return count;
+    }
+
+    /** @brief Consumer side: copies up to @p count items. @return items read. */
+    int read(T* dest, int count) {
+        const uint32_t head = this->head.load(std::memory_order_relaxed);
+        const int available = static_cast<int>(tail.load(std::memory_order_acquire) - head);
+        if (count > available) count = available;
+        for (int i = 0; i < count; ++i) dest[i] = items[(head + static_cast<uint32_t>(i)) & Mask];
+        this->head.store(head + static_cast<uint32_t>(count), std::memory_order_release);
+        return count;
+    }
+
+    /** @brief Items queued. Exact on either side for its own end, a snapshot otherwise. */
+    int size() const {
+        return static_cast<int>(tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire));
+    }
+
+    int space() const { return Capacity - size(); }
+
+    static constexpr int capacity() { return Capacity; }
+
+private:
+    static constexpr uint32_t Mask = static_cast<uint32_t>(Capacity - 1);
+
+    T items[Capacity];
+    std::atomic<uint32_t> head{0};
+    std::atomic<uint32_t> tail{0};
+};
+
+} // namespace common
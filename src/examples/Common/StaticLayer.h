@@ -0,0 +1,126 @@
+#pragma once
+#include "graphics/Renderer.h"
+#include <cstdint>
+
+namespace common {
+
+/**
+ * @brief Retained draw list for a background that never changes.
+ *
+ * StaticLayer records the same calls a Renderer takes (drawFilledRectangle,
+ * drawLine, drawPixel), so an entity can write its background once as a
+ * template paint(canvas) function and run it either into the layer or
+ * straight into the renderer:
+ *
+ *     if (!layer.isBuilt()) { layer.begin(); paint(layer); layer.end(); }
+ *     if (!layer.draw(renderer)) paint(renderer);
+ *
+ * This is a draw list, not a pixel cache: replaying it still issues one
+ * Renderer call per recorded primitive. What recording changes is that
+ * loops and layout math run once, axis-aligned lines replay as filled
+ * rectangles, and a primitive that continues the previous one in the same
+ * color is merged into it, so runs of pixels or touching dashes become one
+ * fill. Isolated primitives (a starfield, separate swatches) replay exactly
+ * as they were drawn and gain nothing; the STATIC LAYER page of the
+ * RenderBenchmark measures replay against direct drawing.
+ *
+ * The list is rebuilt only after invalidate(). A diagonal line or more than
+ * MaxRects primitives cannot be retained. draw() then returns false and the
+ * owner paints directly, as before.
+ */
+template <int MaxRects>
+class StaticLayer {
+public:
+    /** @brief Starts a new recording, discarding the previous list. */
+    void begin() {
+        count = 0;
+        unsupported = false;
+        built = false;
+    }
+
+    /** @brief Finishes the recording; draw() replays it from now on. */
+    void end() { built = true; }
+
+    void invalidate() { built = false; }
+    bool isBuilt() const { return built; }
+    int getRectCount() const { return count; }
+
+    void drawFilledRectangle(int x, int y, int w, int h, pixelroot32::graphics::Color color) {
+        if (w <= 0 || h <= 0) return;
+        if (count > 0) {
+            Rect& last = rects[count - 1];
+            if (last.color == color) {
+                // Continues the previous rect to the right or downwards: grow it.
+                if (last.y == y && last.h == h && last.x + last.w == x) {
+                    last.w = static_cast<int16_t>(last.w + w);
+                    return;
+                }
+                if (last.x == x && last.w == w && last.y + last.h == y) {
+                    last.h = static_cast<int16_t>(last.h + h);
+                    return;
+                }
+            }
+        }
+        if (count >= MaxRects) {
+            unsupported = true;
+            return;
+        }
+        rects[count++] = { static_cast<int16_t>(x), static_cast<int16_t>(y),
+                           static_cast<int16_t>(w), static_cast<int16_t>(h), color };
+    }
+
+    /** @brief Records a horizontal or vertical line, endpoints included. */
+    void drawLine(int x0, int y0, int x1, int y1, pixelroot32::graphics::Color color) {
+        if (x0 > x1) swap(x0, x1);
+        if (y0 > y1) swap(y0, y1);
+        if (x0 != x1 && y0 != y1) {
+            unsupported = true;
+            return;
+        }
+        drawFilledRectangle(x0, y0, x1 - x0 + 1, y1 - y0 + 1, color);
+    }
+
+    void drawPixel(int x, int y, pixelroot32::graphics::Color color) {
+        drawFilledRectangle(x, y, 1, 1, color);
+    }
+
+    /**
+     * @brief Replays the list into a Renderer (or anything with the same fill and pixel calls).
+     * @return false, drawing nothing, if the list is not built or could not be retained.
+     */
+    template <typename Target>
+    bool draw(Target& renderer) const {
+        if (!built || unsupported) return false;
+        for (int i = 0; i < count; ++i) {
+            const Rect& r = rects[i];
+            if (r.w == 1 && r.h == 1) {
+                renderer.drawPixel(r.x, r.y, r.color);
+            } else {
+                renderer.drawFilledRectangle(r.x, r.y, r.w, r.h, r.color);
+            }
+        }
+        return true;
+    }
+
+private:
+    struct Rect {
+        int16_t x;
+        int16_t y;
+        int16_t w;
+        int16_t h;
+        pixelroot32::graphics::Color color;
+    };
+
+    static void swap(int& a, int& b) {
+        const int t = a;
+        a = b;
+        b = t;
+    }
+
+    Rect rects[MaxRects] = {};
+    int count = 0;
+    bool unsupported = false;
+    bool built = false;
+};
+
+} // namespace common
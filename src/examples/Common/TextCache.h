@@ -0,0 +1,241 @@
+#pragma once
+#include "graphics/Renderer.h"
+#include "graphics/FontManager.h"
+#include "RowUnpack.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace common {
+
+/** @brief A filled rectangle of a rasterized string, relative to its top-left corner. */
+struct TextRun {
+    int16_t x;
+    int16_t w;
+    uint8_t y;
+    uint8_t h;
+};
+
+/**
+ * @brief Bounded LRU cache of rasterized strings.
+ *
+ * Renderer::drawText walks the font glyph by glyph and bit by bit on every
+ * call, even when a HUD label shows the same value for hundreds of frames.
+ * TextCache rasterizes a string once into filled runs: horizontal runs of
+ * each glyph row, scaled by the text size and merged downwards when the next
+ * row repeats them, so vertical strokes become one rectangle. Drawing a
+ * cached label skips the glyph and bit walk but is not a single blit: it is
+ * one drawFilledRectangle per run, a few dozen for a size-1 HUD string
+ * (getRunCount()). The TEXT CACHE page of the RenderBenchmark measures
+ * that against drawText for the HUD strings of the games.
+ *
+ * Entries are keyed by text, font, color and size. A label whose text
+ * changes (a new score) misses and takes over the least recently used entry;
+ * nothing is re-rasterized while the text stays the same.
+ *
+ * Glyphs advance by (glyphWidth + spacing) * size, and characters outside the
+ * font are skipped but still advance, as in drawText. Strings longer than
+ * MaxChars or needing more than MaxRuns runs are drawn with the renderer.
+ */
+template <int Capacity, int MaxChars = 16, int MaxRuns = 96>
+class TextCache {
+public:
+    static_assert(Capacity > 0, "TextCache needs at least one entry");
+
+    TextCache() { clear(); }
+
+    void clear() {
+        for (int i = 0; i < Capacity; ++i) {
+            slots[i] = Slot{};
+        }
+        clock = 0;
+        rasters = 0;
+        resetStats();
+    }
+
+    /** @brief Drop-in for Renderer::drawText(text, x, y, color, size). */
+    template <typename Target>
+    void drawText(Target& renderer, const char* text, int x, int y,
+                  pixelroot32::graphics::Color color, uint8_t size) {
+        if (const Slot* slot = acquire(text, color, size)) {
+            drawRuns(renderer, *slot, x, y);
+        } else {
+            renderer.drawText(text, x, y, color, size);
+        }
+    }
+
+    /** @brief Drop-in for Renderer::drawTextCentered(text, y, color, size). */
+    template <typename Target>
+    void drawTextCentered(Target& renderer, const char* text, int y,
+                          pixelroot32::graphics::Color color, uint8_t size) {
+        if (const Slot* slot = acquire(text, color, size)) {
+            drawRuns(renderer, *slot, (renderer.getWidth() - slot->width) / 2, y);
+        } else {
+            renderer.drawTextCentered(text, y, color, size);
+        }
+    }
+
+    /**
+     * @brief Strings rasterized since the last call; the scene reads this once per frame.
+     * With every label cached this stays at 0 until a value changes.
+     */
+    int takeRasterCount() {
+        const int count = rasters;
+        rasters = 0;
+        return count;
+    }
+
+    /** @brief Fill calls a cached string draws with; -1 if it is not cached (or fell back). */
+    int getRunCount(const char* text, pixelroot32::graphics::Color color, uint8_t size) const {
+        const pixelroot32::graphics::Font* font = pixelroot32::graphics::FontManager::getDefaultFont();
+        for (int i = 0; i < Capacity; ++i) {
+            const Slot& slot = slots[i];
+            if (slot.used && slot.valid && slot.font == font && slot.color == color && slot.size == size &&
+                std::strcmp(slot.text, text) == 0) {
+                return slot.runCount;
+            }
+        }
+        return -1;
+    }
+
+    unsigned long getHits() const { return hits; }
+    unsigned long getMisses() const { return misses; }
+
+    int getHitRatePercent() const {
+        const unsigned long total = hits + misses;
+        return total ? static_cast<int>((hits * 100UL) / total) : 0;
+    }
+
+    int getUsedEntries() const {
+        int used = 0;
+        for (int i = 0; i < Capacity; ++i) {
+            if (slots[i].used && slots[i].valid) ++used;
+        }
+        return used;
+    }
+
+    static constexpr std::size_t getMemoryBytes() { return sizeof(Slot) * Capacity; }
+
+    void resetStats() {
+        hits = 0;
+        misses = 0;
+    }
+
+private:
+    struct Slot {
+        char text[MaxChars + 1] = {};
+        const pixelroot32::graphics::Font* font = nullptr;
+        pixelroot32::graphics::Color color = pixelroot32::graphics::Color::White;
+        uint8_t size = 0;
+        int16_t width = 0;
+        TextRun runs[MaxRuns] = {};
+        int runCount = 0;
+        unsigned long lastUse = 0;
+        bool used = false;
+        bool valid = false;
+    };
+
+    const Slot* acquire(const char* text, pixelroot32::graphics::Color color, uint8_t size) {
+        const pixelroot32::graphics::Font* font = pixelroot32::graphics::FontManager::getDefaultFont();
+        if (!font || !text || size == 0 || std::strlen(text) > static_cast<std::size_t>(MaxChars)) {
+            return nullptr;
+        }
+        ++clock;
+
+        int victim = 0;
+        for (int i = 0; i < Capacity; ++i) {
+            Slot& slot = slots[i];
+            if (slot.used && slot.font == font && slot.color == color && slot.size == size &&
+                std::strcmp(slot.text, text) == 0) {
+                slot.lastUse = clock;
+                // A remembered rejection: skip rasterizing and let the caller fall back.
+                if (!slot.valid) return nullptr;
+                ++hits;
+                return &slot;
+            }
+            if (!slot.used) {
+                if (slots[victim].used) victim = i;
+            } else if (slots[victim].used && slot.lastUse < slots[victim].lastUse) {
+                victim = i;
+            }
+        }
+
+        ++misses;
+        ++rasters;
+        Slot& slot = slots[victim];
+        std::strcpy(slot.text, text);
+        slot.font = font;
+        slot.color = color;
+        slot.size = size;
+        slot.lastUse = clock;
+        slot.used = true;
+        slot.valid = rasterize(slot);
+        return slot.valid ? &slot : nullptr;
+    }
+
+    static bool rasterize(Slot& slot) {
+        const pixelroot32::graphics::Font& font = *slot.font;
+        const int size = slot.size;
+        const int advance = (font.glyphWidth + font.spacing) * size;
+        const int length = static_cast<int>(std::strlen(slot.text));
+        slot.runCount = 0;
+        slot.width = static_cast<int16_t>(length > 0 ? length * advance - font.spacing * size : 0);
+        if (font.glyphWidth > 16 || font.glyphHeight * size > 255) return false;
+
+        for (int row = 0; row < font.glyphHeight; ++row) {
+            const uint8_t y = static_cast<uint8_t>(row * size);
+            int runX = 0;
+            int runW = 0;
+            for (int i = 0; i < length; ++i) {
+                const unsigned char c = static_cast<unsigned char>(slot.text[i]);
+                if (c < font.firstChar || c > font.lastChar) continue;
+                const pixelroot32::graphics::Sprite& glyph = font.glyphs[c - font.firstChar];
+                uint8_t bits[16];
+                unpackRow(glyph.data[row], font.glyphWidth, 0, font.glyphWidth, false, bits);
+                for (int gx = 0; gx < font.glyphWidth; ++gx) {
+                    if (!bits[gx]) continue;
+                    const int px = i * advance + gx * size;
+                    if (runW > 0 && runX + runW == px) {
+                        runW += size;
+                        continue;
+                    }
+                    if (runW > 0 && !addRun(slot, runX, y, runW)) return false;
+                    runX = px;
+                    runW = size;
+                }
+            }
+            if (runW > 0 && !addRun(slot, runX, y, runW)) return false;
+        }
+        return true;
+    }
+
+    // Grows a run ending just above this one with the same extent, or appends a new one.
+    static bool addRun(Slot& slot, int x, uint8_t y, int w) {
+        for (int i = 0; i < slot.runCount; ++i) {
+            TextRun& run = slot.runs[i];
+            if (run.x == x && run.w == w && run.y + run.h == y) {
+                run.h = static_cast<uint8_t>(run.h + slot.size);
+                return true;
+            }
+        }
+        if (slot.runCount >= MaxRuns) return false;
+        slot.runs[slot.runCount++] = { static_cast<int16_t>(x), static_cast<int16_t>(w), y, slot.size };
+        return true;
+    }
+
+    template <typename Target>
+    static void drawRuns(Target& renderer, const Slot& slot, int x, int y) {
+        for (int i = 0; i < slot.runCount; ++i) {
+            const TextRun& run = slot.runs[i];
+            renderer.drawFilledRectangle(x + run.x, y + run.y, run.w, run.h, slot.color);
+        }
+    }
+
+    Slot slots[Capacity];
+    unsigned long clock;
+    unsigned long hits;
+    unsigned long misses;
+    int rasters;
+};
+
+} // namespace common
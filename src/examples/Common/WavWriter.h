@@ -0,0 +1,83 @@
+#pragma once
+#ifdef PLATFORM_NATIVE
+#include <cstdint>
+#include <cstdio>
+
+namespace common {
+
+/**
+ * @brief Writes mono 16-bit PCM to a .wav file (native builds only).
+ *
+ * For checking audio output offline: open(), append blocks with write(),
+ * and close() patches the sizes into the header.
+ */
+class WavWriter {
+public:
+    ~WavWriter() { close(); }
+
+    bool open(const char* path, int sampleRate) {
+        close();
+        file = std::fopen(path, "wb");
+        if (!file) return false;
+        frames = 0;
+        rate = static_cast<uint32_t>(sampleRate);
+        writeHeader();
+        return true;
+    }
+
+    void write(const int16_t* samples, int count) {
+        if (!file || count <= 0) return;
+        // WAV is little-endian; write byte by byte so the host's order does not matter.
+        for (int i = 0; i < count; ++i) {
+            const uint16_t s = static_cast<uint16_t>(samples[i]);
+            std::fputc(s & 0xFF, file);
+            std::fputc(s >> 8, file);
+        }
+        frames += static_cast<uint32_t>(count);
+    }
+
+    bool close() {
+        if (!file) return false;
+        std::fseek(file, 0, SEEK_SET);
+        writeHeader();
+        const bool ok = std::fclose(file) == 0;
+        file = nullptr;
+        return ok;
+    }
+
+    bool isOpen() const { return file != nullptr; }
+    uint32_t getFrames() const { return frames; }
+
+private:
+    void put32(uint32_t value) {
+        for (int i = 0; i < 4; ++i) std::fputc((value >> (8 * i)) & 0xFF, file);
+    }
+
+    void put16(uint16_t value) {
+        std::fputc(value & 0xFF, file);
+        std::fputc(value >> 8, file);
+    }
+
+    void writeHeader() {
+        const uint32_t dataBytes = frames * 2;
+        std::fputs("RIFF", file);
+        put32(36 + dataBytes);
+        std::fputs("WAVEfmt ", file);
+        put32(16);
+        put16(1);         // PCM
+        put16(1);         // Mono
+        put32(rate);
+        put32(rate * 2);  // Bytes per second
+        put16(2);         // Bytes per frame
+        put16(16);        // Bits per sample
+        std::fputs("data", file);
+        put32(dataBytes);
+    }
+
+    std::FILE* file = nullptr;
+    uint32_t frames = 0;
+    uint32_t rate = 22050;
+};
+
+} // namespace common
+#endif
@@ -4,6 +4,7 @@
 #include "graphics/Renderer.h"
 #include "graphics/FontManager.h"
 #include "graphics/Font5x7.h"
+#include "examples/Common/ScaledFont.h"
 #include <cstdio>
 
 namespace pr32 = pixelroot32;
@@ -13,6 +14,12 @@ extern pr32::core::Engine engine;
 
 namespace fonttest {
 
+#ifdef PLATFORM_NATIVE
+namespace {
+constexpr uint8_t BTN_B = 5;
+}
+#endif
+
 class FontTestScene::TestBackground : public pr32::core::Entity {
 public:
     TestBackground()
@@ -31,8 +38,9 @@ public:
 
 class FontTestScene::TestText : public pr32::core::Entity {
 public:
-    TestText()
-        : pr32::core::Entity(0.0f, 0.0f, DISPLAY_WIDTH, DISPLAY_HEIGHT, pr32::core::EntityType::GENERIC) {
+    explicit TestText(const common::PropFontBuilder<>& propFont)
+        : pr32::core::Entity(0.0f, 0.0f, DISPLAY_WIDTH, DISPLAY_HEIGHT, pr32::core::EntityType::GENERIC),
+          propFont(propFont) {
         setRenderLayer(1);
     }
 
@@ -43,7 +51,7 @@ public:
         int y = 10;
         
         // Title
-        renderer.drawTextCentered("FONT TEST", y, Color::White, 2);
+        scaledFont.drawTextCentered(renderer, "FONT TEST", y, Color::White, 2);
         y += 25;
         
         // Test 1: Different sizes
@@ -52,18 +60,31 @@ public:
         y += 15;
         
         renderer.drawText("Size 2:", 10, y, Color::Cyan, 1);
-        renderer.drawText("Hello World!", 70, y, Color::White, 2);
+        scaledFont.drawText(renderer, "Hello World!", 70, y, Color::White, 2);
         y += 25;
         
         renderer.drawText("Size 3:", 10, y, Color::Cyan, 1);
-        renderer.drawText("Hello World!", 70, y, Color::White, 3);
+        scaledFont.drawText(renderer, "Hello World!", 70, y, Color::White, 3);
         y += 35;
         
         // Test 2: Centered text
         renderer.drawTextCentered("CENTERED TEXT", y, Color::Yellow, 1);
         y += 20;
-        renderer.drawTextCentered("SIZE 2 CENTERED", y, Color::Yellow, 2);
+        scaledFont.drawTextCentered(renderer, "SIZE 2 CENTERED", y, Color::Yellow, 2);
         y += 25;
+
+        // Test 2b: Proportional font, centered from measureText (no rasterizing)
+        if (propFont.isValid()) {
+            const common::PropFont& prop = propFont.get();
+            const char* sample = "Proportional: TAVERN, Yo.";
+            char widths[48];
+            snprintf(widths, sizeof(widths), "Width: %d px (fixed %d px)",
+                     common::measureText(prop, sample), fixedWidth(sample));
+            common::drawTextCentered(renderer, prop, sample, y, Color::Yellow);
+            y += 12;
+            common::drawTextCentered(renderer, prop, widths, y, Color::Gray);
+            y += 20;
+        }
         
         // Test 3: All ASCII characters (in rows)
         renderer.drawText("ASCII 32-63:", 10, y, Color::Green, 1);
@@ -130,13 +151,38 @@ public:
                      font->firstChar, font->lastChar);
             renderer.drawText(info, 10, y, Color::Cyan, 1);
         }
+
+#ifdef PIXELROOT32_ENABLE_DEBUG_OVERLAY
+        // Expanded-glyph pool usage against its fixed budget.
+        char pool[40];
+        snprintf(pool, sizeof(pool), "GLYPHS %d/%d %dB",
+                 scaledFont.getExpandedGlyphs(), MaxScaledGlyphs,
+                 static_cast<int>(ScaledGlyphs::getMemoryBytes()));
+        renderer.drawText(pool, 10, DISPLAY_HEIGHT - 10, Color::DarkGray, 1);
+#endif
+    }
+
+private:
+    static int fixedWidth(const char* text) {
+        const pr32::graphics::Font* font = pr32::graphics::FontManager::getDefaultFont();
+        if (!font) return 0;
+        int length = 0;
+        while (text[length]) ++length;
+        return length * (font->glyphWidth + font->spacing);
     }
+
+    const common::PropFontBuilder<>& propFont;
+
+    // Size 2 and 3 text on this page uses 30 distinct glyphs (spaces included).
+    static constexpr int MaxScaledGlyphs = 32;
+    using ScaledGlyphs = common::ScaledFont<MaxScaledGlyphs>;
+    ScaledGlyphs scaledFont;
 };
 
 FontTestScene::FontTestScene()
     : background(nullptr), testText(nullptr) {
     background = new TestBackground();
-    testText = new TestText();
+    testText = new TestText(propFont);
     
     addEntity(background);
     addEntity(testText);
@@ -162,15 +208,36 @@ void FontTestScene::init() {
     if (!defaultFont) {
         // Fallback: set it explicitly
         pr32::graphics::FontManager::setDefaultFont(&pr32::graphics::FONT_5X7);
+        defaultFont = &pr32::graphics::FONT_5X7;
+    }
+
+    // Convert the fixed-width font into a proportional one with a few kerned pairs.
+    if (!propFont.isValid() && propFont.build(*defaultFont)) {
+        propFont.addKerning("AVVAATTAAYYALTLYTaTeToTyT.T,Y.Y,F.F,P.P,");
     }
 }
 
 void FontTestScene::update(unsigned long deltaTime) {
     Scene::update(deltaTime);
+
+#ifdef PLATFORM_NATIVE
+    // Native builds double as the offline converter: B writes a header that
+    // can be compiled into a game as constant data.
+    if (engine.getInputManager().isButtonPressed(BTN_B) && propFont.isValid()) {
+        exportResult = propFont.writeHeader("font_prop5x7.h", "FONT_PROP_5X7") ? 1 : -1;
+    }
+#endif
 }
 
 void FontTestScene::draw(pr32::graphics::Renderer& renderer) {
     Scene::draw(renderer);
+
+#ifdef PLATFORM_NATIVE
+    const char* status = "B: EXPORT .H";
+    if (exportResult > 0) status = "WROTE .H";
+    if (exportResult < 0) status = "EXPORT FAILED";
+    renderer.drawText(status, 130, DISPLAY_HEIGHT - 10, exportResult < 0 ? Color::Red : Color::DarkGray, 1);
+#endif
 }
 
 }
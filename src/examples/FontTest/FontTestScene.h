@@ -2,6 +2,7 @@
 #include "core/Scene.h"
 #include "graphics/Renderer.h"
 #include "EngineConfig.h"
+#include "examples/Common/PropFont.h"
 
 namespace fonttest {
 
@@ -13,6 +14,9 @@ namespace fonttest {
  * - Centered text
  * - All ASCII characters (space to tilde)
  * - Edge cases (empty strings, unsupported characters, long text)
+ * - A proportional version of the default font (common::PropFont), measured
+ *   without rasterizing and centered from that measurement; on native
+ *   builds B writes it out as a header (font_prop5x7.h)
  * - Visual verification that font rendering works correctly
  */
 class FontTestScene : public pixelroot32::core::Scene {
@@ -29,6 +33,14 @@ private:
     
     TestBackground* background;
     TestText* testText;
+
+    // Proportional copy of the default font, converted in init().
+    common::PropFontBuilder<> propFont;
+
+#ifdef PLATFORM_NATIVE
+    // Result of the last B export: 0 none yet, 1 written, -1 failed.
+    int exportResult = 0;
+#endif
 };
 
 }
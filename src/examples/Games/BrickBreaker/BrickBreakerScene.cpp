@@ -15,14 +15,6 @@ namespace brickbreaker {
 using Color = pr32::graphics::Color;
 using namespace pr32::audio;
 
-// Define the Atari-style background music (a simple 4-note loop)
-static const MusicNote ATARI_MELODY[] = {
-    { Note::A, 3, 0.25f, 0.3f },
-    { Note::C, 4, 0.25f, 0.3f },
-    { Note::E, 4, 0.25f, 0.3f },
-    { Note::G, 4, 0.25f, 0.3f }
-};
-
 BrickBreakerScene::BrickBreakerScene() {
     musicPlayer = new MusicPlayer(engine.getAudioEngine());
 }
@@ -32,12 +24,8 @@ BrickBreakerScene::~BrickBreakerScene() {
 }
 
 void BrickBreakerScene::setupMusic() {
-    bgmTrack.notes = ATARI_MELODY;
-    bgmTrack.count = sizeof(ATARI_MELODY) / sizeof(MusicNote);
-    bgmTrack.loop = true;
-    bgmTrack.channelType = WaveType::TRIANGLE; // Triangle wave for a softer Atari feel
-    bgmTrack.duty = 0.5f;
-    
+    bgmTrack = music::BGM_TRACK;
+
     musicPlayer->play(bgmTrack);
     musicPlayer->setTempoFactor(1.2f);
 }
@@ -1,6 +1,7 @@
 #pragma once
 #include <cstdint>
 #include <audio/AudioTypes.h>
+#include <audio/AudioMusicTypes.h>
 
 namespace brickbreaker {
 
@@ -26,4 +27,22 @@ namespace brickbreaker {
         const pixelroot32::audio::AudioEvent START_GAME = { pixelroot32::audio::WaveType::PULSE, 880.0f, 0.2f, 0.5f, 0.5f };
     }
 
+    // Atari-style background music, a simple 4-note loop (also packed by the Audio Lab)
+    namespace music {
+        const pixelroot32::audio::MusicNote ATARI_MELODY[] = {
+            { pixelroot32::audio::Note::A, 3, 0.25f, 0.3f },
+            { pixelroot32::audio::Note::C, 4, 0.25f, 0.3f },
+            { pixelroot32::audio::Note::E, 4, 0.25f, 0.3f },
+            { pixelroot32::audio::Note::G, 4, 0.25f, 0.3f }
+        };
+
+        const pixelroot32::audio::MusicTrack BGM_TRACK = {
+            ATARI_MELODY,
+            sizeof(ATARI_MELODY) / sizeof(pixelroot32::audio::MusicNote),
+            true,
+            pixelroot32::audio::WaveType::TRIANGLE, // Triangle wave for a softer Atari feel
+            0.5f
+        };
+    }
+
 }
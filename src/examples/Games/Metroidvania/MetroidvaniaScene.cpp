@@ -8,6 +8,7 @@
 #include "assets/MetroidvaniaSceneOneTileMap.h"
 #include "assets/PlayerPalette.h"
 #include <cstdint>
+#include <cstdio>
 
 namespace {
     constexpr int MAX_PLATFORM_RECTS = metroidvaniasceneonetilemap::MAP_WIDTH * metroidvaniasceneonetilemap::MAP_HEIGHT;
@@ -131,12 +132,48 @@ void MetroidvaniaScene::update(unsigned long deltaTime) {
     // Send processed inputs to the player actor.
     if (player) player->setInput(moveDir, vDir, jumpPressed);
 
+#ifdef PR32_COMMON_OVERDRAW_MAP
+    overdrawControls.update(input);
+#endif
+
     // Update all entities in the scene.
     pixelroot32::core::Scene::update(deltaTime);
 }
 
 void MetroidvaniaScene::draw(pr32::graphics::Renderer& renderer) {
     pixelroot32::core::Scene::draw(renderer);
+    drawOverdrawStats(renderer);
+}
+
+// The three map layers are drawn on top of each other every frame; the
+// heatmap shows where the platforms and stairs add to the background fill.
+// Hidden until B is pressed; P then writes the map to a PGM file.
+void MetroidvaniaScene::drawOverdrawStats(pr32::graphics::Renderer& renderer) {
+#ifdef PR32_COMMON_OVERDRAW_MAP
+    if (!overdrawControls.isVisible()) return;
+
+    overdraw.beginFrame();
+    overdraw.addTileMap(metroidvaniasceneonetilemap::background, 0, 0);
+    overdraw.addTileMap(metroidvaniasceneonetilemap::platforms, 0, 0);
+    overdraw.addTileMap(metroidvaniasceneonetilemap::stairs, 0, 0);
+    if (player) {
+        overdraw.addSprite(player->getCurrentSprite(), static_cast<int>(player->x), static_cast<int>(player->y),
+                           player->isFacingLeft());
+    }
+
+    char buffer[32];
+    const unsigned long percent = overdraw.getOverdrawPercent();
+    std::snprintf(buffer, sizeof(buffer), "OVERDRAW %lu.%02luX MAX %d",
+                  percent / 100, percent % 100, overdraw.getMax());
+    renderer.drawText(buffer, 4, 4, Color::White, 1);
+    overdraw.drawHeatmap(renderer, DISPLAY_WIDTH - overdraw.ThumbWidth - 4, 4);
+
+    if (overdrawControls.takeDumpRequest()) {
+        overdraw.writePGM("overdraw_metroidvania.pgm");
+    }
+#else
+    (void)renderer;
+#endif
 }
 
 }
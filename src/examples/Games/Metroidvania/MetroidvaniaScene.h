@@ -3,6 +3,7 @@
 #include "graphics/Renderer.h"
 #include "graphics/Color.h"
 #include "EngineConfig.h"
+#include "examples/Common/OverdrawMap.h"
 
 namespace metroidvania {
 
@@ -15,7 +16,14 @@ public:
     void draw(pixelroot32::graphics::Renderer& renderer) override;
 
 private:
+    void drawOverdrawStats(pixelroot32::graphics::Renderer& renderer);
+
     PlayerActor* player = nullptr;
+
+#ifdef PR32_COMMON_OVERDRAW_MAP
+    common::OverdrawMap<DISPLAY_WIDTH, DISPLAY_HEIGHT> overdraw;
+    common::OverdrawControls overdrawControls;
+#endif
 };
 
 }
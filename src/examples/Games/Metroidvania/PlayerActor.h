@@ -33,6 +33,10 @@ public:
     /** @brief Draws the current state sprite. */
     void draw(pixelroot32::graphics::Renderer& renderer) override;
 
+    /** @brief The sprite and orientation draw() uses this frame. */
+    pixelroot32::graphics::Sprite4bpp getCurrentSprite() const { return getSpriteByState(); }
+    bool isFacingLeft() const { return facingLeft; }
+
     /** @brief Defines the player's collision area. */
     pixelroot32::core::Rect getHitBox() override;
 
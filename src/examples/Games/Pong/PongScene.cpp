@@ -2,6 +2,7 @@
 #include "core/Engine.h"
 #include "core/PhysicsActor.h"
 #include "audio/AudioTypes.h"
+#include "examples/Common/StaticLayer.h"
 
 namespace pr32 = pixelroot32;
 
@@ -27,11 +28,25 @@ public:
         int screenWidth = renderer.getWidth();
         int screenHeight = renderer.getHeight();
 
-        renderer.drawFilledRectangle(0, 0, screenWidth, playAreaTop, Color::DarkGray);
-        renderer.drawFilledRectangle(0, playAreaBottom, screenWidth, screenHeight - playAreaBottom, Color::DarkGray);
+        // Bars, borders and the dashed net never move: record them once and
+        // replay. The lines replay as fills; the STATIC LAYER page of the
+        // RenderBenchmark measures that against drawing them directly.
+        if (!layer.isBuilt()) {
+            layer.begin();
+            paint(layer, screenWidth, screenHeight);
+            layer.end();
+        }
+        if (!layer.draw(renderer)) paint(renderer, screenWidth, screenHeight);
+    }
 
-        renderer.drawLine(0, playAreaTop, screenWidth, playAreaTop, Color::White);
-        renderer.drawLine(0, playAreaBottom, screenWidth, playAreaBottom, Color::White);
+private:
+    template <typename Canvas>
+    void paint(Canvas& canvas, int screenWidth, int screenHeight) const {
+        canvas.drawFilledRectangle(0, 0, screenWidth, playAreaTop, Color::DarkGray);
+        canvas.drawFilledRectangle(0, playAreaBottom, screenWidth, screenHeight - playAreaBottom, Color::DarkGray);
+
+        canvas.drawLine(0, playAreaTop, screenWidth - 1, playAreaTop, Color::White);
+        canvas.drawLine(0, playAreaBottom, screenWidth - 1, playAreaBottom, Color::White);
 
         int16_t centerX = screenWidth / 2;
         int16_t dashHeight = 10;
@@ -42,13 +57,13 @@ public:
             if (dashEnd > screenHeight) {
                 dashEnd = screenHeight;
             }
-            renderer.drawLine(centerX, y, centerX, dashEnd, Color::LightGray);
+            canvas.drawLine(centerX, y, centerX, dashEnd, Color::LightGray);
         }
     }
 
-private:
     int playAreaTop;
     int playAreaBottom;
+    common::StaticLayer<32> layer;  // 4 bars/borders + 16 dashes at 240 px
 };
 
 void PongScene::init() {
@@ -159,11 +174,11 @@ void PongScene::draw(pr32::graphics::Renderer& renderer) {
     char scoreStr[16];
     snprintf(scoreStr, sizeof(scoreStr), "%d : %d", leftScore, rightScore);
     int16_t scoreY = playAreaTop / 2 - 8;
-    renderer.drawTextCentered(scoreStr, scoreY, Color::Black, 2);
+    textCache.drawTextCentered(renderer, scoreStr, scoreY, Color::Black, 2);
 
     if (gameOver) {
-        renderer.drawTextCentered("GAME OVER", 120, Color::White, 2);
-        renderer.drawTextCentered("PRESS A TO START", 150, Color::White, 1);
+        textCache.drawTextCentered(renderer, "GAME OVER", 120, Color::White, 2);
+        textCache.drawTextCentered(renderer, "PRESS A TO START", 150, Color::White, 1);
     }
 }
 
@@ -5,6 +5,7 @@
 #include "graphics/Color.h"
 #include "EngineConfig.h"
 #include "GameConstants.h"
+#include "examples/Common/TextCache.h"
 
 namespace pong {
 
@@ -29,6 +30,9 @@ private:
     int playAreaTop;
     int playAreaBottom;
 
+    // Score and game-over strings, re-rasterized only when they change.
+    common::TextCache<3, 16, 160> textCache;
+
     void resetGame();
 };
 
@@ -46,16 +46,6 @@ SnakeScene::SnakeScene()
 }
 
 SnakeScene::~SnakeScene() {
-    for (auto* segment : snakeSegments) {
-        removeEntity(segment);
-    }
-    snakeSegments.clear();
-
-    for (auto* segment : segmentPool) {
-        delete segment;
-    }
-    segmentPool.clear();
-
     if (background) {
         removeEntity(background);
         delete background;
@@ -74,35 +64,25 @@ void SnakeScene::init() {
     resetGame();
 }
 
-// Rebuild the snake from the pooled segments and reset all game variables.
+// Rebuild the snake body and reset all game variables.
 void SnakeScene::resetGame() {
-    if (segmentPool.empty()) {
-        segmentPool.reserve(MaxSnakeSegments);
-        for (int i = 0; i < MaxSnakeSegments; ++i) {
-            auto* segment = new SnakeSegmentActor(0, 0, false);
-            segmentPool.push_back(segment);
-        }
-    }
+    body.clear();
 
-    for (auto* segment : snakeSegments) {
-        removeEntity(segment);
+    // HUD rows are never playable, so keep them out of the free-cell index.
+    occupancy.clear();
+    for (int row = 0; row < TOP_UI_GRID_ROWS; ++row) {
+        occupancy.occupyRow(row);
     }
-    snakeSegments.clear();
 
     int centerX = GRID_WIDTH / 2;
     int centerY = GRID_HEIGHT / 2;
 
+    // Push from tail to head so the head ends up at the back of the ring.
     const int initialLength = 4;
-    for (int i = 0; i < initialLength; ++i) {
-        int x = centerX - i;
-        int y = centerY;
-        bool head = (i == 0);
-        SnakeSegmentActor* segment = segmentPool[i];
-        segment->setCellPosition(x, y);
-        segment->resetAlive();
-        segment->setHead(head);
-        snakeSegments.push_back(segment);
-        addEntity(segment);
+    for (int i = initialLength - 1; i >= 0; --i) {
+        Point cell = { centerX - i, centerY };
+        body.pushBack(cell);
+        occupancy.occupy(cell.x, cell.y);
     }
 
     dir = DIR_RIGHT;
@@ -114,24 +94,16 @@ void SnakeScene::resetGame() {
     spawnFood();
 }
 
-// Randomly place food on the grid, avoiding any cell occupied by the snake.
-void SnakeScene::spawnFood() {
-    bool valid = false;
-    while (!valid) {
-        int fx = std::rand() % GRID_WIDTH;
-        int fy = TOP_UI_GRID_ROWS + (std::rand() % (GRID_HEIGHT - TOP_UI_GRID_ROWS));
-        valid = true;
-        for (const auto* segment : snakeSegments) {
-            if (segment->getCellX() == fx && segment->getCellY() == fy) {
-                valid = false;
-                break;
-            }
-        }
-        if (valid) {
-            food.x = fx;
-            food.y = fy;
-        }
+// Place food on a uniformly random free cell. Returns false when the board is full.
+bool SnakeScene::spawnFood() {
+    int fx = 0;
+    int fy = 0;
+    if (!occupancy.pickRandomFree(fx, fy)) {
+        return false;
     }
+    food.x = fx;
+    food.y = fy;
+    return true;
 }
 
 // Main game loop: handle input, timed movement, growth, scoring, and game over.
@@ -171,13 +143,13 @@ void SnakeScene::update(unsigned long deltaTime) {
         lastMoveTime = now;
         dir = nextDir;
 
-        if (snakeSegments.empty()) {
+        if (body.isEmpty()) {
             return;
         }
 
-        SnakeSegmentActor* headSegment = snakeSegments[0];
-        int newX = headSegment->getCellX();
-        int newY = headSegment->getCellY();
+        const Point& head = body.back();
+        int newX = head.x;
+        int newY = head.y;
 
         if (dir == DIR_UP) {
             newY -= 1;
@@ -203,51 +175,50 @@ void SnakeScene::update(unsigned long deltaTime) {
 
         bool ateFood = (newX == food.x && newY == food.y);
 
-        if (ateFood) {
-            SnakeSegmentActor* newHeadSegment = nullptr;
-            if (snakeSegments.size() < segmentPool.size()) {
-                newHeadSegment = segmentPool[snakeSegments.size()];
-            }
-            if (newHeadSegment) {
-                newHeadSegment->setCellPosition(newX, newY);
-                newHeadSegment->resetAlive();
-                newHeadSegment->setHead(true);
+        // The tail vacates its cell this step unless the snake grows,
+        // so the head is allowed to move into it.
+        if (!ateFood) {
+            const Point& tail = body.front();
+            occupancy.release(tail.x, tail.y);
+            body.popFront();
+        }
 
-                snakeSegments.insert(snakeSegments.begin(), newHeadSegment);
-                addEntity(newHeadSegment);
+        if (occupancy.isOccupied(newX, newY)) {
+            gameOver = true;
+            pr32::audio::AudioEvent ev{};
+            ev.type = pr32::audio::WaveType::NOISE;
+            ev.frequency = 700.0f;
+            ev.duration = 0.25f;
+            ev.volume = 0.9f;
+            ev.duty = 0.5f;
+            audio.playEvent(ev);
+            return;
+        }
 
-                for (size_t i = 1; i < snakeSegments.size(); ++i) {
-                    snakeSegments[i]->setHead(false);
-                }
+        Point newHead = { newX, newY };
+        body.pushBack(newHead);
+        occupancy.occupy(newX, newY);
 
-                score += SCORE_PER_FOOD;
-                spawnFood();
-                pr32::audio::AudioEvent eatEv{};
-                eatEv.type = pr32::audio::WaveType::PULSE;
-                eatEv.frequency = 1200.0f;
-                eatEv.duration = 0.12f;
-                eatEv.volume = 0.8f;
-                eatEv.duty = 0.5f;
-                audio.playEvent(eatEv);
-                if (moveInterval > MIN_MOVE_INTERVAL_MS) {
-                    moveInterval -= MOVE_INTERVAL_STEP_MS;
-                    if (moveInterval < MIN_MOVE_INTERVAL_MS) {
-                        moveInterval = MIN_MOVE_INTERVAL_MS;
-                    }
+        if (ateFood) {
+            score += SCORE_PER_FOOD;
+            if (!spawnFood()) {
+                // The snake fills every playable cell: nothing left to eat.
+                gameOver = true;
+            }
+            pr32::audio::AudioEvent eatEv{};
+            eatEv.type = pr32::audio::WaveType::PULSE;
+            eatEv.frequency = 1200.0f;
+            eatEv.duration = 0.12f;
+            eatEv.volume = 0.8f;
+            eatEv.duty = 0.5f;
+            audio.playEvent(eatEv);
+            if (moveInterval > MIN_MOVE_INTERVAL_MS) {
+                moveInterval -= MOVE_INTERVAL_STEP_MS;
+                if (moveInterval < MIN_MOVE_INTERVAL_MS) {
+                    moveInterval = MIN_MOVE_INTERVAL_MS;
                 }
             }
         } else {
-            SnakeSegmentActor* tail = snakeSegments.back();
-            snakeSegments.pop_back();
-            tail->setCellPosition(newX, newY);
-            snakeSegments.insert(snakeSegments.begin(), tail);
-
-            for (size_t i = 0; i < snakeSegments.size(); ++i) {
-                snakeSegments[i]->setHead(i == 0);
-            }
-
-            snakeSegments[0]->resetAlive();
-
             pr32::audio::AudioEvent moveEv{};
             moveEv.type = pr32::audio::WaveType::PULSE;
             moveEv.frequency = 300.0f;
@@ -259,26 +230,31 @@ void SnakeScene::update(unsigned long deltaTime) {
     }
 
     pr32::core::Scene::update(deltaTime);
+}
 
-    if (!gameOver && !snakeSegments.empty()) {
-        SnakeSegmentActor* headSegment = snakeSegments[0];
-        if (!headSegment->isAlive()) {
-            gameOver = true;
-            pr32::audio::AudioEvent ev{};
-            ev.type = pr32::audio::WaveType::NOISE;
-            ev.frequency = 700.0f;
-            ev.duration = 0.25f;
-            ev.volume = 0.9f;
-            ev.duty = 0.5f;
-            audio.playEvent(ev);
-        }
+// Draw the whole body in one pass over the ring: no per-segment entities.
+void SnakeScene::drawBody(pr32::graphics::Renderer& renderer) const {
+    using Color = pr32::graphics::Color;
+
+    const std::size_t count = body.size();
+    if (count == 0) {
+        return;
     }
+
+    for (std::size_t i = 0; i + 1 < count; ++i) {
+        const Point& cell = body[i];
+        renderer.drawFilledRectangle(cell.x * CELL_SIZE, cell.y * CELL_SIZE, CELL_SIZE - 1, CELL_SIZE - 1, Color::DarkGreen);
+    }
+
+    const Point& head = body.back();
+    renderer.drawFilledRectangle(head.x * CELL_SIZE, head.y * CELL_SIZE, CELL_SIZE - 1, CELL_SIZE - 1, Color::LightGreen);
 }
 
 void SnakeScene::draw(pr32::graphics::Renderer& renderer) {
     using Color = pr32::graphics::Color;
 
     pr32::core::Scene::draw(renderer);
+    drawBody(renderer);
 
     int fx = food.x * CELL_SIZE;
     int fy = food.y * CELL_SIZE;
@@ -289,7 +265,7 @@ void SnakeScene::draw(pr32::graphics::Renderer& renderer) {
     renderer.drawText(scoreStr, 5, 5, Color::White, 1);
 
     if (gameOver) {
-        renderer.drawTextCentered("GAME OVER", 100, Color::White, 2);
+        bannerFont.drawTextCentered(renderer, "GAME OVER", 100, Color::White, 2);
         renderer.drawTextCentered("Press A to Restart", 130, Color::White, 1);
     }
 }
@@ -3,8 +3,9 @@
 #include "graphics/Renderer.h"
 #include "EngineConfig.h"
 #include "GameConstants.h"
-#include "SnakeSegmentActor.h"
-#include <vector>
+#include "examples/Common/GridOccupancy.h"
+#include "examples/Common/RingBuffer.h"
+#include "examples/Common/ScaledFont.h"
 
 namespace snake {
 
@@ -29,11 +30,12 @@ public:
     void draw(pixelroot32::graphics::Renderer& renderer) override;
 
 private:
-    static constexpr int MaxSnakeSegments = GRID_WIDTH * GRID_HEIGHT;
+    static constexpr int MaxSnakeSegments = GRID_WIDTH * (GRID_HEIGHT - TOP_UI_GRID_ROWS);
     class SnakeBackground;
     SnakeBackground* background;
-    std::vector<SnakeSegmentActor*> snakeSegments;
-    std::vector<SnakeSegmentActor*> segmentPool;
+    // Body cells, tail at the front and head at the back.
+    common::RingBuffer<Point, MaxSnakeSegments> body;
+    common::GridOccupancy<GRID_WIDTH, GRID_HEIGHT> occupancy;
     Point food;
     Direction dir;
     Direction nextDir;
@@ -41,9 +43,12 @@ private:
     bool gameOver;
     unsigned long lastMoveTime;
     int moveInterval;
+    // 2x glyphs for the "GAME OVER" banner.
+    common::ScaledFont<8> bannerFont;
 
     void resetGame();
-    void spawnFood();
+    bool spawnFood();
+    void drawBody(pixelroot32::graphics::Renderer& renderer) const;
 };
 
 }
@@ -1,5 +1,4 @@
 #include "AlienActor.h"
-#include "GameConstants.h"
 #include "AlienSprites.h"
 
 namespace spaceinvaders {
@@ -24,8 +23,29 @@ static const SpriteAnimationFrame OCTOPUS_ANIM_FRAMES[] = {
     { &OCTOPUS_F2, nullptr }
 };
 
+void AlienActor::prewarm(SpriteCache& cache) {
+    const SpriteAnimationFrame* tables[] = { SQUID_ANIM_FRAMES, CRAB_ANIM_FRAMES, OCTOPUS_ANIM_FRAMES };
+    const std::size_t counts[] = {
+        sizeof(SQUID_ANIM_FRAMES) / sizeof(SpriteAnimationFrame),
+        sizeof(CRAB_ANIM_FRAMES) / sizeof(SpriteAnimationFrame),
+        sizeof(OCTOPUS_ANIM_FRAMES) / sizeof(SpriteAnimationFrame)
+    };
+
+    for (std::size_t t = 0; t < 3; ++t) {
+        for (std::size_t f = 0; f < counts[t]; ++f) {
+            const SpriteAnimationFrame& frame = tables[t][f];
+            if (frame.multiSprite) {
+                cache.prewarm(*frame.multiSprite, SPRITE_SCALE, SPRITE_SCALE);
+            } else if (frame.sprite) {
+                cache.prewarm(*frame.sprite, SPRITE_SCALE, SPRITE_SCALE);
+            }
+        }
+    }
+}
+
 AlienActor::AlienActor(float x, float y, AlienType type)
-    : pixelroot32::core::Actor(x, y, 0, 0), type(type), active(true) {
+    : pixelroot32::core::Actor(x, y, 0, 0), type(type), active(true),
+      formation(nullptr), formationIndex(-1), animationStep(0) {
 
     // Configure sprite dimensions based on alien type.
     switch (type) {
@@ -57,21 +77,38 @@ AlienActor::AlienActor(float x, float y, AlienType type)
     animation.reset();
 }
 
+void AlienActor::bindFormation(const AlienFormation* owner, int index) {
+    formation = owner;
+    formationIndex = index;
+    animationStep = owner ? owner->getStepCount() : 0;
+    animation.reset();
+    syncWithFormation();
+}
+
 void AlienActor::update(unsigned long deltaTime) {
     (void)deltaTime;
-    // Aliens don't move themselves in update(), they are moved by Scene controller
+    // Aliens don't move themselves; the scene moves the formation origin.
+    syncWithFormation();
 }
 
-void AlienActor::move(float dx, float dy) {
-    x += dx;
-    y += dy;
+// Pull the absolute position from the formation and catch the animation up with
+// its step counter, so a horde step never has to touch every alien.
+void AlienActor::syncWithFormation() {
+    if (!formation || formationIndex < 0) return;
+    x = formation->getMemberX(formationIndex);
+    y = formation->getMemberY(formationIndex);
     // Step-based animation: advance one frame per logical movement step.
-    animation.step();
+    while (animationStep != formation->getStepCount()) {
+        animation.step();
+        ++animationStep;
+    }
 }
 
 void AlienActor::draw(pixelroot32::graphics::Renderer& renderer) {
     if (!active) return;
-    
+    // The horde may have stepped after this actor's update() ran this frame.
+    syncWithFormation();
+
     using Color       = pixelroot32::graphics::Color;
     using Sprite      = pixelroot32::graphics::Sprite;
     using MultiSprite = pixelroot32::graphics::MultiSprite;
@@ -90,7 +127,18 @@ void AlienActor::draw(pixelroot32::graphics::Renderer& renderer) {
     }
 }
 
+const Sprite* AlienActor::getCurrentSprite() {
+    syncWithFormation();
+    return animation.getCurrentSprite();
+}
+
+const MultiSprite* AlienActor::getCurrentMultiSprite() {
+    syncWithFormation();
+    return animation.getCurrentMultiSprite();
+}
+
 pixelroot32::core::Rect AlienActor::getHitBox() {
+    syncWithFormation();
     return {x, y, (int)width, (int)height};
 }
 
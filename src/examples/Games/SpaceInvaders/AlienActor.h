@@ -1,6 +1,9 @@
 #pragma once
 #include "core/Actor.h"
 #include "graphics/Renderer.h"
+#include "GameConstants.h"
+#include "examples/Common/Formation.h"
+#include "SpriteCache.h"
 
 namespace spaceinvaders {
 
@@ -10,6 +13,8 @@ enum class AlienType {
     OCTOPUS
 };
 
+using AlienFormation = common::Formation<ALIEN_ROWS, ALIEN_COLS>;
+
 class AlienActor : public pixelroot32::core::Actor {
 public:
     AlienActor(float x, float y, AlienType type);
@@ -17,8 +22,9 @@ public:
     void update(unsigned long deltaTime) override;
     void draw(pixelroot32::graphics::Renderer& renderer);
     
-    // Custom movement (called by Scene)
-    void move(float dx, float dy);
+    // Position and animation step are driven by the shared horde formation.
+    void bindFormation(const AlienFormation* owner, int index);
+    int getFormationIndex() const { return formationIndex; }
     
     pixelroot32::core::Rect getHitBox() override;
     void onCollision(pixelroot32::core::Actor* other) override;
@@ -27,10 +33,22 @@ public:
     void kill() { active = false; }
     int getScoreValue() const;
 
+    // Scales every alien animation frame into the cache ahead of the first draw.
+    static void prewarm(SpriteCache& cache);
+
+    // Current animation frame, for scenes that batch-draw the horde.
+    const pixelroot32::graphics::Sprite* getCurrentSprite();
+    const pixelroot32::graphics::MultiSprite* getCurrentMultiSprite();
+
 private:
     AlienType type;
     bool active;
+    const AlienFormation* formation;
+    int formationIndex;
+    unsigned int animationStep;
     pixelroot32::graphics::SpriteAnimation animation;
+
+    void syncWithFormation();
 };
 
 }
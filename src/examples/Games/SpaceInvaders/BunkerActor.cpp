@@ -12,14 +12,11 @@ void BunkerActor::update(unsigned long deltaTime) {
 }
 
 void BunkerActor::draw(pixelroot32::graphics::Renderer& renderer) {
-    if (health <= 0) return;
+    int visibleHeight = getVisibleHeight();
+    if (visibleHeight <= 0) return;
 
     using Color = pixelroot32::graphics::Color;
-    float ratio = (maxHealth > 0) ? (float)health / (float)maxHealth : 0.0f;
-    if (ratio <= 0.0f) return;
-
-    int visibleHeight = (int)(height * ratio);
-    if (visibleHeight <= 0) return;
+    float ratio = (float)health / (float)maxHealth;
 
     int drawY = (int)(y + (height - visibleHeight));
 
@@ -33,6 +30,12 @@ void BunkerActor::draw(pixelroot32::graphics::Renderer& renderer) {
     renderer.drawFilledRectangle((int)x, drawY, width, visibleHeight, c);
 }
 
+int BunkerActor::getVisibleHeight() const {
+    if (health <= 0 || maxHealth <= 0) return 0;
+    float ratio = (float)health / (float)maxHealth;
+    return (int)(height * ratio);
+}
+
 pixelroot32::core::Rect BunkerActor::getHitBox() {
     if (health <= 0) {
         return {x, y + height, width, 0};
@@ -17,6 +17,9 @@ public:
     void applyDamage(int amount);
     bool isDestroyed() const;
 
+    // Rows of the bunker still drawn, from the bottom up; 0 once destroyed.
+    int getVisibleHeight() const;
+
 private:
     int health;
     int maxHealth;
@@ -1,5 +1,6 @@
 #pragma once
 #include "EngineConfig.h"
+#include "audio/AudioMusicTypes.h"
 #include <cstdint>
 
 namespace spaceinvaders {
@@ -80,4 +81,66 @@ namespace spaceinvaders {
     // Layer 4: Enemy Projectile
     // Layer 5: Bunker (if added)
 
+    namespace music {
+        // Base four-note bass pattern: "tu tu tu tu" (also packed by the Audio Lab)
+        const pixelroot32::audio::InstrumentPreset BASS_INSTRUMENT = pixelroot32::audio::INSTR_PULSE_BASS;
+
+        const pixelroot32::audio::MusicNote BGM_SLOW_NOTES[] = {
+            pixelroot32::audio::makeNote(BASS_INSTRUMENT, pixelroot32::audio::Note::C, 0.21f),
+            pixelroot32::audio::makeRest(0.207f),
+            pixelroot32::audio::makeNote(BASS_INSTRUMENT, pixelroot32::audio::Note::C, 0.21f),
+            pixelroot32::audio::makeRest(0.207f),
+            pixelroot32::audio::makeNote(BASS_INSTRUMENT, pixelroot32::audio::Note::C, 0.21f),
+            pixelroot32::audio::makeRest(0.207f),
+            pixelroot32::audio::makeNote(BASS_INSTRUMENT, pixelroot32::audio::Note::C, 0.21f),
+            pixelroot32::audio::makeRest(0.207f),
+        };
+
+        const pixelroot32::audio::MusicNote BGM_MEDIUM_NOTES[] = {
+            pixelroot32::audio::makeNote(BASS_INSTRUMENT, pixelroot32::audio::Note::C, 0.12f),
+            pixelroot32::audio::makeRest(0.06f),
+            pixelroot32::audio::makeNote(BASS_INSTRUMENT, pixelroot32::audio::Note::C, 0.12f),
+            pixelroot32::audio::makeRest(0.06f),
+            pixelroot32::audio::makeNote(BASS_INSTRUMENT, pixelroot32::audio::Note::C, 0.12f),
+            pixelroot32::audio::makeRest(0.06f),
+            pixelroot32::audio::makeNote(BASS_INSTRUMENT, pixelroot32::audio::Note::C, 0.12f),
+            pixelroot32::audio::makeRest(0.06f),
+        };
+
+        const pixelroot32::audio::MusicNote BGM_FAST_NOTES[] = {
+            pixelroot32::audio::makeNote(BASS_INSTRUMENT, pixelroot32::audio::Note::C, 0.08f),
+            pixelroot32::audio::makeRest(0.04f),
+            pixelroot32::audio::makeNote(BASS_INSTRUMENT, pixelroot32::audio::Note::C, 0.08f),
+            pixelroot32::audio::makeRest(0.04f),
+            pixelroot32::audio::makeNote(BASS_INSTRUMENT, pixelroot32::audio::Note::C, 0.08f),
+            pixelroot32::audio::makeRest(0.04f),
+            pixelroot32::audio::makeNote(BASS_INSTRUMENT, pixelroot32::audio::Note::C, 0.08f),
+            pixelroot32::audio::makeRest(0.04f),
+        };
+
+        const pixelroot32::audio::MusicTrack BGM_SLOW_TRACK = {
+            BGM_SLOW_NOTES,
+            sizeof(BGM_SLOW_NOTES) / sizeof(pixelroot32::audio::MusicNote),
+            true,
+            pixelroot32::audio::WaveType::PULSE,
+            BASS_INSTRUMENT.duty
+        };
+
+        const pixelroot32::audio::MusicTrack BGM_MEDIUM_TRACK = {
+            BGM_MEDIUM_NOTES,
+            sizeof(BGM_MEDIUM_NOTES) / sizeof(pixelroot32::audio::MusicNote),
+            true,
+            pixelroot32::audio::WaveType::PULSE,
+            BASS_INSTRUMENT.duty
+        };
+
+        const pixelroot32::audio::MusicTrack BGM_FAST_TRACK = {
+            BGM_FAST_NOTES,
+            sizeof(BGM_FAST_NOTES) / sizeof(pixelroot32::audio::MusicNote),
+            true,
+            pixelroot32::audio::WaveType::PULSE,
+            BASS_INSTRUMENT.duty
+        };
+    }
+
 }
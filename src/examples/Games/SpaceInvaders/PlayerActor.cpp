@@ -24,11 +24,15 @@ static const uint16_t PLAYER_SHIP_BITS[] = {
 static const Sprite PLAYER_SHIP_SPRITE = { PLAYER_SHIP_BITS, PLAYER_SPRITE_W, PLAYER_SPRITE_H };
 
 PlayerActor::PlayerActor(float x, float y)
-    : PhysicsActor(x, y, PLAYER_WIDTH, PLAYER_HEIGHT), isAlive(true) {
+    : PhysicsActor(x, y, PLAYER_WIDTH, PLAYER_HEIGHT), isAlive(true), spriteCache(nullptr) {
     setWorldSize(DISPLAY_WIDTH, DISPLAY_HEIGHT);
     setLimits(pr32::core::LimitRect(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT));
 }
 
+void PlayerActor::prewarm(SpriteCache& cache) {
+    cache.prewarm(PLAYER_SHIP_SPRITE, SPRITE_SCALE, SPRITE_SCALE);
+}
+
 void PlayerActor::update(unsigned long deltaTime) {
     handleInput();
     PhysicsActor::update(deltaTime); // Apply velocity and limits
@@ -57,10 +61,23 @@ bool PlayerActor::wantsToShoot() const {
     return input.isButtonPressed(BTN_FIRE);
 }
 
+const Sprite* PlayerActor::getDrawnSprite() const {
+    return isAlive ? &PLAYER_SHIP_SPRITE : nullptr;
+}
+
 void PlayerActor::draw(pr32::graphics::Renderer& renderer) {
     if (!isAlive) return;
     
     using Color = pr32::graphics::Color;
+    if (spriteCache) {
+        spriteCache->drawSprite(renderer, PLAYER_SHIP_SPRITE,
+                                static_cast<int>(x),
+                                static_cast<int>(y),
+                                SPRITE_SCALE,
+                                SPRITE_SCALE,
+                                Color::Yellow);
+        return;
+    }
     renderer.drawSprite(PLAYER_SHIP_SPRITE,
                         static_cast<int>(x),
                         static_cast<int>(y),
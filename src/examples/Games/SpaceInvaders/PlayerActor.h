@@ -1,6 +1,7 @@
 #pragma once
 #include "core/PhysicsActor.h"
 #include "graphics/Renderer.h"
+#include "SpriteCache.h"
 
 namespace spaceinvaders {
 
@@ -14,12 +15,20 @@ public:
     pixelroot32::core::Rect getHitBox() override;
     void onCollision(pixelroot32::core::Actor* other) override;
 
+    // Draws through the scene's pre-scaled sprite cache when one is set.
+    void setSpriteCache(SpriteCache* cache) { spriteCache = cache; }
+    static void prewarm(SpriteCache& cache);
+
+    // The ship sprite draw() blits at SPRITE_SCALE, or nullptr while the player is dead.
+    const pixelroot32::graphics::Sprite* getDrawnSprite() const;
+
     bool isFireDown() const;
     bool wantsToShoot() const;
 
 private:
     void handleInput();
     bool isAlive;
+    SpriteCache* spriteCache;
 };
 
 }
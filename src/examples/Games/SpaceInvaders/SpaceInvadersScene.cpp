@@ -11,6 +11,7 @@
 #include <cstdlib>
 #include <cstdio>
 #include "assets/Background.h"
+#include "examples/Common/SpriteRLE.h"
 
 namespace pr32 = pixelroot32;
 extern pr32::core::Engine engine;
@@ -23,8 +24,6 @@ using pixelroot32::audio::AudioEvent;
 using pixelroot32::audio::WaveType;
 using pixelroot32::audio::MusicNote;
 using pixelroot32::audio::MusicTrack;
-using pixelroot32::audio::InstrumentPreset;
-using pixelroot32::audio::INSTR_PULSE_BASS;
 using pixelroot32::audio::Note;
 
 #ifdef PIXELROOT32_ENABLE_SCENE_ARENA
@@ -55,73 +54,33 @@ public:
     }
 };
 
-// Base four-note bass pattern: "tu tu tu tu"
-static const InstrumentPreset BASS_INSTRUMENT = INSTR_PULSE_BASS;
-
-static const MusicNote BGM_SLOW_NOTES[] = {
-    pixelroot32::audio::makeNote(BASS_INSTRUMENT, Note::C, 0.21f),
-    pixelroot32::audio::makeRest(0.207f),
-    pixelroot32::audio::makeNote(BASS_INSTRUMENT, Note::C, 0.21f),
-    pixelroot32::audio::makeRest(0.207f),
-    pixelroot32::audio::makeNote(BASS_INSTRUMENT, Note::C, 0.21f),
-    pixelroot32::audio::makeRest(0.207f),
-    pixelroot32::audio::makeNote(BASS_INSTRUMENT, Note::C, 0.21f),
-    pixelroot32::audio::makeRest(0.207f),
-};
-
-static const MusicNote BGM_MEDIUM_NOTES[] = {
-    pixelroot32::audio::makeNote(BASS_INSTRUMENT, Note::C, 0.12f),
-    pixelroot32::audio::makeRest(0.06f),
-    pixelroot32::audio::makeNote(BASS_INSTRUMENT, Note::C, 0.12f),
-    pixelroot32::audio::makeRest(0.06f),
-    pixelroot32::audio::makeNote(BASS_INSTRUMENT, Note::C, 0.12f),
-    pixelroot32::audio::makeRest(0.06f),
-    pixelroot32::audio::makeNote(BASS_INSTRUMENT, Note::C, 0.12f),
-    pixelroot32::audio::makeRest(0.06f),
-};
-
-static const MusicNote BGM_FAST_NOTES[] = {
-    pixelroot32::audio::makeNote(BASS_INSTRUMENT, Note::C, 0.08f),
-    pixelroot32::audio::makeRest(0.04f),
-    pixelroot32::audio::makeNote(BASS_INSTRUMENT, Note::C, 0.08f),
-    pixelroot32::audio::makeRest(0.04f),
-    pixelroot32::audio::makeNote(BASS_INSTRUMENT, Note::C, 0.08f),
-    pixelroot32::audio::makeRest(0.04f),
-    pixelroot32::audio::makeNote(BASS_INSTRUMENT, Note::C, 0.08f),
-    pixelroot32::audio::makeRest(0.04f),
-};
+// Added right after the aliens, so the batched horde keeps their place in the
+// draw order: over the player, under the bunkers and projectiles.
+class HordeLayer : public pr32::core::Entity {
+public:
+    explicit HordeLayer(SpaceInvadersScene& scene)
+        : pr32::core::Entity(0.0f, 0.0f, DISPLAY_WIDTH, DISPLAY_HEIGHT, pr32::core::EntityType::GENERIC),
+          scene(scene) {
+    }
 
-static const MusicTrack BGM_SLOW_TRACK = {
-    BGM_SLOW_NOTES,
-    sizeof(BGM_SLOW_NOTES) / sizeof(MusicNote),
-    true,
-    WaveType::PULSE,
-    BASS_INSTRUMENT.duty
-};
+    void update(unsigned long) override {
+    }
 
-static const MusicTrack BGM_MEDIUM_TRACK = {
-    BGM_MEDIUM_NOTES,
-    sizeof(BGM_MEDIUM_NOTES) / sizeof(MusicNote),
-    true,
-    WaveType::PULSE,
-    BASS_INSTRUMENT.duty
-};
+    void draw(pr32::graphics::Renderer& renderer) override {
+        scene.drawHorde(renderer);
+    }
 
-static const MusicTrack BGM_FAST_TRACK = {
-    BGM_FAST_NOTES,
-    sizeof(BGM_FAST_NOTES) / sizeof(MusicNote),
-    true,
-    WaveType::PULSE,
-    BASS_INSTRUMENT.duty
+private:
+    SpaceInvadersScene& scene;
 };
 
 // --- WIN / GAME OVER MUSIC ---
 
 static const MusicNote WIN_NOTES[] = {
-    pixelroot32::audio::makeNote(BASS_INSTRUMENT, Note::C, 0.15f),
-    pixelroot32::audio::makeNote(BASS_INSTRUMENT, Note::E, 0.15f),
-    pixelroot32::audio::makeNote(BASS_INSTRUMENT, Note::G, 0.15f),
-    pixelroot32::audio::makeNote(BASS_INSTRUMENT, Note::C, 0.4f), // C High ideally, but using C for safety if C_High undefined
+    pixelroot32::audio::makeNote(music::BASS_INSTRUMENT, Note::C, 0.15f),
+    pixelroot32::audio::makeNote(music::BASS_INSTRUMENT, Note::E, 0.15f),
+    pixelroot32::audio::makeNote(music::BASS_INSTRUMENT, Note::G, 0.15f),
+    pixelroot32::audio::makeNote(music::BASS_INSTRUMENT, Note::C, 0.4f), // C High ideally, but using C for safety if C_High undefined
     pixelroot32::audio::makeRest(0.1f)
 };
 
@@ -130,13 +89,13 @@ static const MusicTrack WIN_TRACK = {
     sizeof(WIN_NOTES) / sizeof(MusicNote),
     false, // No loop
     WaveType::PULSE,
-    BASS_INSTRUMENT.duty
+    music::BASS_INSTRUMENT.duty
 };
 
 static const MusicNote GAME_OVER_NOTES[] = {
-    pixelroot32::audio::makeNote(BASS_INSTRUMENT, Note::G, 0.2f),
-    pixelroot32::audio::makeNote(BASS_INSTRUMENT, Note::E, 0.2f), // Using E instead of Eb if Eb undefined, checking later
-    pixelroot32::audio::makeNote(BASS_INSTRUMENT, Note::C, 0.4f),
+    pixelroot32::audio::makeNote(music::BASS_INSTRUMENT, Note::G, 0.2f),
+    pixelroot32::audio::makeNote(music::BASS_INSTRUMENT, Note::E, 0.2f), // Using E instead of Eb if Eb undefined, checking later
+    pixelroot32::audio::makeNote(music::BASS_INSTRUMENT, Note::C, 0.4f),
     pixelroot32::audio::makeRest(0.1f)
 };
 
@@ -145,7 +104,7 @@ static const MusicTrack GAME_OVER_TRACK = {
     sizeof(GAME_OVER_NOTES) / sizeof(MusicNote),
     false, // No loop
     WaveType::PULSE,
-    BASS_INSTRUMENT.duty
+    music::BASS_INSTRUMENT.duty
 };
 
 // Simple 8x8 explosion sprites for the player explosion animation.
@@ -193,6 +152,17 @@ static const SpriteAnimationFrame PLAYER_EXPLOSION_FRAMES[] = {
     { &PLAYER_EXPLOSION_F3, nullptr }
 };
 
+// Span-encoded copies of the explosion frames. They are mostly transparent, so
+// only their opaque runs are drawn instead of testing all 64 bits per frame.
+static constexpr int ExplosionFrameCount = sizeof(PLAYER_EXPLOSION_FRAMES) / sizeof(SpriteAnimationFrame);
+static common::SpriteRLEBuffer<24, 8> PLAYER_EXPLOSION_RLE[ExplosionFrameCount];
+
+void ExplosionAnimation::prepareFrames() {
+    for (int i = 0; i < ExplosionFrameCount; ++i) {
+        PLAYER_EXPLOSION_RLE[i].build(*PLAYER_EXPLOSION_FRAMES[i].sprite);
+    }
+}
+
 ExplosionAnimation::ExplosionAnimation()
     : active(false), x(0.0f), y(0.0f), timeAccumulator(0), stepsDone(0) {
     animation.frames = PLAYER_EXPLOSION_FRAMES;
@@ -245,6 +215,12 @@ void ExplosionAnimation::draw(pr32::graphics::Renderer& renderer) {
     const int drawX = static_cast<int>(x);
     const int drawY = static_cast<int>(y);
 
+    const int frame = animation.current;
+    if (frame < ExplosionFrameCount && PLAYER_EXPLOSION_RLE[frame].isValid()) {
+        common::drawSprite(renderer, PLAYER_EXPLOSION_RLE[frame].get(), drawX, drawY, pr32::graphics::Color::White);
+        return;
+    }
+
     renderer.drawSprite(*sprite, drawX, drawY, pr32::graphics::Color::White);
 }
 
@@ -252,8 +228,13 @@ bool ExplosionAnimation::isActive() const {
     return active;
 }
 
+const Sprite* ExplosionAnimation::getCurrentSprite() {
+    return active ? animation.getCurrentSprite() : nullptr;
+}
+
 SpaceInvadersScene::SpaceInvadersScene()
     : background(nullptr),
+      hordeLayer(nullptr),
       player(nullptr),
       score(0),
       lives(3),
@@ -268,6 +249,7 @@ SpaceInvadersScene::SpaceInvadersScene()
 
     background = new StarfieldBackground();
     addEntity(background);
+    hordeLayer = new HordeLayer(*this);
 
     for (int i = 0; i < MaxEnemyExplosions; ++i) {
         enemyExplosions[i].active = false;
@@ -283,6 +265,10 @@ SpaceInvadersScene::~SpaceInvadersScene() {
         delete background;
         background = nullptr;
     }
+    if (hordeLayer) {
+        delete hordeLayer;
+        hordeLayer = nullptr;
+    }
 }
 
 void SpaceInvadersScene::init() {
@@ -291,9 +277,16 @@ void SpaceInvadersScene::init() {
 #endif
     pr32::graphics::setSpritePalette(pr32::graphics::PaletteType::NES);
     background_assets::init();
+
+    // Scale every SPRITE_SCALE sprite up front so the first frames are blits too.
+    AlienActor::prewarm(spriteCache);
+    PlayerActor::prewarm(spriteCache);
+    spriteCache.resetStats();
+    ExplosionAnimation::prepareFrames();
+
     resetGame();
 
-    engine.getMusicPlayer().play(BGM_SLOW_TRACK);
+    engine.getMusicPlayer().play(music::BGM_SLOW_TRACK);
     currentMusicTempoFactor = 1.0f;
     engine.getMusicPlayer().setTempoFactor(currentMusicTempoFactor);
 }
@@ -342,6 +335,7 @@ void SpaceInvadersScene::resetGame() {
 #else
     player = new PlayerActor(PLAYER_START_X, PLAYER_START_Y);
 #endif
+    player->setSpriteCache(&spriteCache);
     addEntity(player);
 
     spawnAliens();
@@ -381,6 +375,8 @@ void SpaceInvadersScene::resetGame() {
 }
 
 void SpaceInvadersScene::spawnAliens() {
+    formation.reset(ALIEN_START_X, ALIEN_START_Y);
+
     for (int row = 0; row < ALIEN_ROWS; ++row) {
         AlienType type;
         if (row == 0) type = AlienType::SQUID;
@@ -399,10 +395,18 @@ void SpaceInvadersScene::spawnAliens() {
             if (!alien) {
                 continue;
             }
+            int index = formation.addMember(row, col, x - ALIEN_START_X, y - ALIEN_START_Y,
+                                            static_cast<int>(alien->width), static_cast<int>(alien->height));
+            alien->bindFormation(&formation, index);
+            // Drawn in batches by hordeLayer rather than one by one.
+            alien->setVisible(false);
             aliens.push_back(alien);
             addEntity(alien);
         }
     }
+    if (hordeLayer) {
+        addEntity(hordeLayer);
+    }
 }
 
 void SpaceInvadersScene::spawnBunkers() {
@@ -430,10 +434,14 @@ void SpaceInvadersScene::spawnBunkers() {
 }
 
 void SpaceInvadersScene::update(unsigned long deltaTime) {
+#ifdef PR32_COMMON_OVERDRAW_MAP
+    overdrawControls.update(engine.getInputManager());
+#endif
+
     if (gameOver) {
         if (engine.getInputManager().isButtonPressed(BTN_FIRE)) {
             resetGame();
-            engine.getMusicPlayer().play(BGM_SLOW_TRACK);
+            engine.getMusicPlayer().play(music::BGM_SLOW_TRACK);
             currentMusicTempoFactor = 1.0f;
             engine.getMusicPlayer().setTempoFactor(currentMusicTempoFactor);
         }
@@ -511,57 +519,29 @@ void SpaceInvadersScene::updateAliens(unsigned long deltaTime) {
     if (stepTimer >= stepDelay) {
         stepTimer = 0.0f;
         
-        bool edgeHit = false;
-        
-        // Check bounds before moving
-        for (auto* alien : aliens) {
-            if (!alien->isActive()) continue;
-            
-            if (moveDirection == 1) { // Moving Right
-                if (alien->x + alien->width >= DISPLAY_WIDTH - 2) {
-                    edgeHit = true;
-                    break;
-                }
-            } else { // Moving Left
-                if (alien->x <= 2) {
-                    edgeHit = true;
-                    break;
-                }
-            }
+        if (formation.getLiveCount() == 0) {
+            return;
         }
 
+        // Cached formation bounds replace the per-alien edge scan.
+        bool edgeHit = (moveDirection == 1)
+            ? formation.getRight() >= DISPLAY_WIDTH - 2
+            : formation.getLeft() <= 2;
+
         if (edgeHit) {
             moveDirection *= -1;
-            for (auto* alien : aliens) {
-                if (alien->isActive()) {
-                    alien->move(0, ALIEN_DROP_AMOUNT);
-                }
-            }
+            formation.moveBy(0, ALIEN_DROP_AMOUNT);
         } else {
-            float dx = moveDirection * ALIEN_STEP_AMOUNT_X;
-            for (auto* alien : aliens) {
-                if (alien->isActive()) {
-                    alien->move(dx, 0);
-                }
-            }
+            formation.moveBy(moveDirection * ALIEN_STEP_AMOUNT_X, 0);
         }
 
         enemyShoot();
 
-        if (!gameOver && player) {
-            for (auto* alien : aliens) {
-                if (!alien->isActive()) {
-                    continue;
-                }
-                float bottom = alien->y + alien->height;
-                if (bottom >= player->y) {
-                    lives = 0;
-                    gameOver = true;
-                    engine.getMusicPlayer().setTempoFactor(1.0f);
-                    engine.getMusicPlayer().play(GAME_OVER_TRACK);
-                    break;
-                }
-            }
+        if (!gameOver && player && formation.getBottom() >= player->y) {
+            lives = 0;
+            gameOver = true;
+            engine.getMusicPlayer().setTempoFactor(1.0f);
+            engine.getMusicPlayer().play(GAME_OVER_TRACK);
         }
     }
 }
@@ -600,10 +580,11 @@ void SpaceInvadersScene::handleCollisions() {
                     proj->getHitBox().intersects(targetBox)) {
                     proj->deactivate();
                     alien->kill();
+                    formation.kill(alien->getFormationIndex());
                     score += alien->getScoreValue();
 
-                    float ex = alien->x + alien->width * 0.5f;
-                    float ey = alien->y + alien->height * 0.5f;
+                    float ex = targetBox.x + targetBox.width * 0.5f;
+                    float ey = targetBox.y + targetBox.height * 0.5f;
                     spawnEnemyExplosion(ex, ey);
 
                     AudioEvent event{};
@@ -697,27 +678,7 @@ void SpaceInvadersScene::handleCollisions() {
 
 // Select a bottom-most alien and fire an enemy bullet with difficulty-based chance.
 void SpaceInvadersScene::enemyShoot() {
-    std::vector<AlienActor*> bottomAliens;
-    for (auto* candidate : aliens) {
-        if (!candidate->isActive()) {
-            continue;
-        }
-        bool hasBelow = false;
-        for (auto* other : aliens) {
-            if (!other->isActive()) {
-                continue;
-            }
-            if (other->x == candidate->x && other->y > candidate->y) {
-                hasBelow = true;
-                break;
-            }
-        }
-        if (!hasBelow) {
-            bottomAliens.push_back(candidate);
-        }
-    }
-
-    if (bottomAliens.empty()) {
+    if (formation.getLiveCount() == 0) {
         return;
     }
 
@@ -749,15 +710,14 @@ void SpaceInvadersScene::enemyShoot() {
         return;
     }
 
-    int r = std::rand();
-    if (r < 0) {
-        r = -r;
+    // The formation keeps the bottom-most alien of every column cached.
+    int shooter = formation.pickBottomMost(std::rand());
+    if (shooter < 0) {
+        return;
     }
-    std::size_t index = static_cast<std::size_t>(r) % bottomAliens.size();
-    AlienActor* shooter = bottomAliens[index];
 
-    float sx = shooter->x + shooter->width / 2.0f;
-    float sy = shooter->y + shooter->height;
+    float sx = formation.getMemberX(shooter) + formation.getMemberWidth(shooter) / 2.0f;
+    float sy = formation.getMemberY(shooter) + formation.getMemberHeight(shooter);
 
     for (auto* proj : projectiles) {
         if (!proj->isActive()) {
@@ -768,15 +728,11 @@ void SpaceInvadersScene::enemyShoot() {
 }
 
 int SpaceInvadersScene::getActiveAlienCount() const {
-    int count = 0;
-    for (auto* alien : aliens) {
-        if (alien->isActive()) count++;
-    }
-    return count;
+    return formation.getLiveCount();
 }
 
 void SpaceInvadersScene::draw(pr32::graphics::Renderer& renderer) {
-    renderer.drawFilledRectangle(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT, pr32::graphics::Color::Black);
+    countFrameDraws();
     Scene::draw(renderer);
 
     // Draw enemy explosions and player explosion on top of entities.
@@ -785,48 +741,249 @@ void SpaceInvadersScene::draw(pr32::graphics::Renderer& renderer) {
 
     char buffer[32];
 
+    // HUD strings only change with the score or a lost life; in between they
+    // are redrawn from the text cache without touching the font.
     std::snprintf(buffer, sizeof(buffer), "SCORE %04d", score);
-    renderer.drawText(buffer, 4, 4, pr32::graphics::Color::White, 1);
+    textCache.drawText(renderer, buffer, 4, 4, pr32::graphics::Color::White, 1);
+    countText(buffer, 4, 4, 1);
 
     std::snprintf(buffer, sizeof(buffer), "LIVES %d", lives);
-    renderer.drawText(buffer, DISPLAY_WIDTH - 70, 4, pr32::graphics::Color::White, 1);
+    textCache.drawText(renderer, buffer, DISPLAY_WIDTH - 70, 4, pr32::graphics::Color::White, 1);
+    countText(buffer, DISPLAY_WIDTH - 70, 4, 1);
+
+    drawSpriteCacheStats(renderer);
 
     if (gameOver) {
         if (gameWon) {
             std::snprintf(buffer, sizeof(buffer), "YOU WIN!");
             int textY = DISPLAY_HEIGHT / 2 - 8;
-            renderer.drawTextCentered(buffer, textY, pr32::graphics::Color::Green, 2);
+            textCache.drawTextCentered(renderer, buffer, textY, pr32::graphics::Color::Green, 2);
+            countTextCentered(buffer, textY, 2);
         } else {
             std::snprintf(buffer, sizeof(buffer), "GAME OVER");
             int textY = DISPLAY_HEIGHT / 2 - 8;
-            renderer.drawTextCentered(buffer, textY, pr32::graphics::Color::Red, 2);
+            textCache.drawTextCentered(renderer, buffer, textY, pr32::graphics::Color::Red, 2);
+            countTextCentered(buffer, textY, 2);
         }
 
         std::snprintf(buffer, sizeof(buffer), "PRESS FIRE");
         int textY = DISPLAY_HEIGHT / 2 - 8;
-        renderer.drawTextCentered(buffer, textY + 20, pr32::graphics::Color::White, 1);
+        textCache.drawTextCentered(renderer, buffer, textY + 20, pr32::graphics::Color::White, 1);
+        countTextCentered(buffer, textY + 20, 1);
     }
-}
 
-// Smoothly adjust background music tempo based on how close the lowest alien row is to the player.
-void SpaceInvadersScene::updateMusicTempo() {
-    if (gameOver) return;
+    drawTextCacheStats(renderer);
+    drawOverdrawStats(renderer);
+}
 
-    float lowestY = ALIEN_START_Y;
-    bool found = false;
+// Draw live aliens grouped by animation frame. Every alien shares the formation step,
+// so a frame typically costs one cache lookup per alien type instead of 32 scaled draws.
+void SpaceInvadersScene::drawHorde(pr32::graphics::Renderer& renderer) {
+    int groupCount = 0;
 
-    // Find the lowest active alien
     for (auto* alien : aliens) {
-        if (alien->isActive()) {
-            float y = alien->y + alien->height;
-            if (y > lowestY) {
-                lowestY = y;
+        if (!alien->isActive()) {
+            continue;
+        }
+
+        const auto* multiSprite = alien->getCurrentMultiSprite();
+        const auto* sprite = multiSprite ? nullptr : alien->getCurrentSprite();
+
+        HordeGroup* group = nullptr;
+        for (int i = 0; i < groupCount; ++i) {
+            if (hordeGroups[i].sprite == sprite && hordeGroups[i].multiSprite == multiSprite) {
+                group = &hordeGroups[i];
+                break;
+            }
+        }
+        if (!group) {
+            if (groupCount >= MaxHordeGroups) {
+                alien->draw(renderer);
+                continue;
             }
-            found = true;
+            group = &hordeGroups[groupCount++];
+            group->sprite = sprite;
+            group->multiSprite = multiSprite;
+            group->count = 0;
+        }
+        group->instances[group->count++] = {
+            static_cast<int16_t>(alien->x), static_cast<int16_t>(alien->y), false
+        };
+    }
+
+    for (int i = 0; i < groupCount; ++i) {
+        const HordeGroup& group = hordeGroups[i];
+        const SpriteCache::Entry* entry = nullptr;
+        if (group.multiSprite) {
+            entry = spriteCache.acquire(*group.multiSprite, SPRITE_SCALE, SPRITE_SCALE);
+        } else if (group.sprite) {
+            entry = spriteCache.acquire(*group.sprite, SPRITE_SCALE, SPRITE_SCALE);
+        }
+
+        if (entry) {
+            entry->draw(renderer, group.instances, group.count, pr32::graphics::Color::Orange);
+            continue;
+        }
+
+        // Frame does not fit a cache entry: fall back to the renderer's scaler.
+        for (int j = 0; j < group.count; ++j) {
+            const common::SpriteInstance& inst = group.instances[j];
+            if (group.multiSprite) {
+                renderer.drawMultiSprite(*group.multiSprite, inst.x, inst.y, SPRITE_SCALE, SPRITE_SCALE);
+            } else if (group.sprite) {
+                renderer.drawSprite(*group.sprite, inst.x, inst.y, SPRITE_SCALE, SPRITE_SCALE,
+                                    pr32::graphics::Color::Orange);
+            }
+        }
+    }
+}
+
+// Cache footprint and hit rate, shown alongside the engine's debug overlay.
+void SpaceInvadersScene::drawSpriteCacheStats(pr32::graphics::Renderer& renderer) {
+#ifdef PIXELROOT32_ENABLE_DEBUG_OVERLAY
+    char buffer[40];
+    std::snprintf(buffer, sizeof(buffer), "SPR CACHE %d ENT %dB HIT %d%%",
+                  spriteCache.getUsedEntries(),
+                  static_cast<int>(SpriteCache::getMemoryBytes()),
+                  spriteCache.getHitRatePercent());
+    renderer.drawText(buffer, 4, 14, pr32::graphics::Color::DarkGray, 1);
+    countText(buffer, 4, 14, 1);
+#else
+    (void)renderer;
+#endif
+}
+
+// Strings rasterized this frame (0 while the HUD is unchanged) and the text cache hit rate.
+void SpaceInvadersScene::drawTextCacheStats(pr32::graphics::Renderer& renderer) {
+#ifdef PIXELROOT32_ENABLE_DEBUG_OVERLAY
+    char buffer[40];
+    std::snprintf(buffer, sizeof(buffer), "TXT RASTER %d ENT %d HIT %d%%",
+                  textCache.takeRasterCount(),
+                  textCache.getUsedEntries(),
+                  textCache.getHitRatePercent());
+    renderer.drawText(buffer, 4, 34, pr32::graphics::Color::DarkGray, 1);
+    countText(buffer, 4, 34, 1);
+#else
+    (void)renderer;
+#endif
+}
+
+// Starts this frame's overdraw count with everything Scene::draw() and the
+// effects will draw: the starfield, ship, horde, bunkers, shots and explosions.
+// Text is added where it is drawn.
+void SpaceInvadersScene::countFrameDraws() {
+#ifdef PR32_COMMON_OVERDRAW_MAP
+    if (!overdrawControls.isVisible()) return;
+
+    overdraw.beginFrame();
+
+    overdraw.addRect(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+    for (int i = 0; i < background_assets::STAR_COUNT; ++i) {
+        overdraw.addPixel(static_cast<int>(background_assets::STAR_X[i]),
+                          static_cast<int>(background_assets::STAR_Y[i]));
+    }
+    if (player && player->isVisible()) {
+        if (const Sprite* ship = player->getDrawnSprite()) {
+            overdraw.addSprite(*ship, static_cast<int>(player->x), static_cast<int>(player->y),
+                               SPRITE_SCALE, SPRITE_SCALE);
         }
     }
+    for (auto* alien : aliens) {
+        if (!alien->isActive()) {
+            continue;
+        }
+        const int ax = static_cast<int>(alien->x);
+        const int ay = static_cast<int>(alien->y);
+        if (const auto* multiSprite = alien->getCurrentMultiSprite()) {
+            // Cached crabs are blitted from one flattened bitmap, not layer by layer.
+            const SpriteCache::Entry* entry = spriteCache.find(*multiSprite, SPRITE_SCALE, SPRITE_SCALE);
+            overdraw.addMultiSprite(*multiSprite, ax, ay, SPRITE_SCALE, SPRITE_SCALE,
+                                    !(entry && entry->isFlattened()));
+        } else if (const Sprite* sprite = alien->getCurrentSprite()) {
+            overdraw.addSprite(*sprite, ax, ay, SPRITE_SCALE, SPRITE_SCALE);
+        }
+    }
+    for (auto* bunker : bunkers) {
+        const int visibleHeight = bunker->getVisibleHeight();
+        if (visibleHeight > 0) {
+            overdraw.addRect(static_cast<int>(bunker->x), static_cast<int>(bunker->y + (bunker->height - visibleHeight)),
+                             bunker->width, visibleHeight);
+        }
+    }
+    for (auto* projectile : projectiles) {
+        if (projectile->isActive()) {
+            overdraw.addRect(static_cast<int>(projectile->x), static_cast<int>(projectile->y),
+                             projectile->width, projectile->height);
+        }
+    }
+    // Each enemy explosion is a 5-pixel horizontal and a 5-pixel vertical line.
+    for (int i = 0; i < MaxEnemyExplosions; ++i) {
+        if (enemyExplosions[i].active) {
+            const int cx = static_cast<int>(enemyExplosions[i].x);
+            const int cy = static_cast<int>(enemyExplosions[i].y);
+            overdraw.addRect(cx - 2, cy, 5, 1);
+            overdraw.addRect(cx, cy - 2, 1, 5);
+        }
+    }
+    if (const Sprite* frame = playerExplosion.getCurrentSprite()) {
+        overdraw.addSprite(*frame, playerExplosion.getDrawX(), playerExplosion.getDrawY());
+    }
+#endif
+}
 
-    if (!found) return;
+void SpaceInvadersScene::countText(const char* text, int x, int y, uint8_t size) {
+#ifdef PR32_COMMON_OVERDRAW_MAP
+    if (overdrawControls.isVisible()) overdraw.addText(text, x, y, size);
+#else
+    (void)text;
+    (void)x;
+    (void)y;
+    (void)size;
+#endif
+}
+
+void SpaceInvadersScene::countTextCentered(const char* text, int y, uint8_t size) {
+#ifdef PR32_COMMON_OVERDRAW_MAP
+    if (overdrawControls.isVisible()) overdraw.addTextCentered(text, y, size);
+#else
+    (void)text;
+    (void)y;
+    (void)size;
+#endif
+}
+
+// Overdraw of the frame so far: total writes, worst pixel and a heatmap
+// thumbnail. Drawn last, and the readout and thumbnail themselves are not
+// counted. Hidden until B is pressed; P then writes the map to a PGM file.
+void SpaceInvadersScene::drawOverdrawStats(pr32::graphics::Renderer& renderer) {
+#ifdef PR32_COMMON_OVERDRAW_MAP
+    if (!overdrawControls.isVisible()) return;
+
+    char buffer[40];
+    const unsigned long percent = overdraw.getOverdrawPercent();
+    std::snprintf(buffer, sizeof(buffer), "OVERDRAW %lu.%02luX MAX %d",
+                  percent / 100, percent % 100, overdraw.getMax());
+    renderer.drawText(buffer, 4, 24, pr32::graphics::Color::DarkGray, 1);
+    overdraw.drawHeatmap(renderer, DISPLAY_WIDTH - overdraw.ThumbWidth - 4, 36);
+
+    if (overdrawControls.takeDumpRequest()) {
+        overdraw.writePGM("overdraw_spaceinvaders.pgm");
+    }
+#else
+    (void)renderer;
+#endif
+}
+
+// Smoothly adjust background music tempo based on how close the lowest alien row is to the player.
+void SpaceInvadersScene::updateMusicTempo() {
+    if (gameOver) return;
+
+    if (formation.getLiveCount() == 0) return;
+
+    float lowestY = formation.getBottom();
+    if (lowestY < ALIEN_START_Y) {
+        lowestY = ALIEN_START_Y;
+    }
 
     // Optimized Threat Factor Calculation (Zero divisions)
     // threat = (currentY - startY) * invRange
@@ -1,6 +1,11 @@
 #pragma once
 #include "core/Scene.h"
 #include "graphics/Renderer.h"
+#include "GameConstants.h"
+#include "examples/Common/Formation.h"
+#include "examples/Common/OverdrawMap.h"
+#include "examples/Common/TextCache.h"
+#include "SpriteCache.h"
 #include <vector>
 
 namespace spaceinvaders {
@@ -11,6 +16,7 @@ namespace spaceinvaders {
     class ProjectileActor;
     class BunkerActor;
     class StarfieldBackground;
+    class HordeLayer;
 
     struct EnemyExplosion {
         bool active;
@@ -35,6 +41,14 @@ namespace spaceinvaders {
         // Returns true while the animation is still playing.
         bool isActive() const;
 
+        // Frame draw() blits unscaled at (getDrawX(), getDrawY()); nullptr when inactive.
+        const pixelroot32::graphics::Sprite* getCurrentSprite();
+        int getDrawX() const { return static_cast<int>(x); }
+        int getDrawY() const { return static_cast<int>(y); }
+
+        // Span-encodes the explosion frames; called once from the scene's init().
+        static void prepareFrames();
+
     private:
         bool active;
         float x;
@@ -59,10 +73,14 @@ namespace spaceinvaders {
         void spawnBunkers();
         void cleanup();
 
+        friend class HordeLayer;
+
         // Custom entity management (due to MAX_ENTITIES limit in base Scene)
         StarfieldBackground* background;
+        HordeLayer* hordeLayer;  // Draws the horde at the aliens' place in the entity list
         PlayerActor* player;
         std::vector<AlienActor*> aliens;
+        common::Formation<ALIEN_ROWS, ALIEN_COLS> formation; // Horde origin, bounds and per-column shooters
         std::vector<ProjectileActor*> projectiles;
         std::vector<BunkerActor*> bunkers;
 
@@ -90,6 +108,37 @@ namespace spaceinvaders {
         // Background music tempo state
         float currentMusicTempoFactor;
 
+        // Pre-scaled sprites, prewarmed in init() so SPRITE_SCALE draws are plain blits.
+        SpriteCache spriteCache;
+
+        // Rasterized HUD strings: score, lives and the end-of-game messages.
+        common::TextCache<6> textCache;
+
+        // Batched horde rendering: live aliens grouped by their current animation
+        // frame, each group blitted with that frame's cached bitmap.
+        struct HordeGroup {
+            const pixelroot32::graphics::Sprite* sprite;
+            const pixelroot32::graphics::MultiSprite* multiSprite;
+            common::SpriteInstance instances[ALIEN_ROWS * ALIEN_COLS];
+            int count;
+        };
+        static constexpr int MaxHordeGroups = 6;
+        HordeGroup hordeGroups[MaxHordeGroups];
+
+        void drawHorde(pixelroot32::graphics::Renderer& renderer);
+        void drawSpriteCacheStats(pixelroot32::graphics::Renderer& renderer);
+        void drawTextCacheStats(pixelroot32::graphics::Renderer& renderer);
+        void drawOverdrawStats(pixelroot32::graphics::Renderer& renderer);
+        void countFrameDraws();
+        void countText(const char* text, int x, int y, uint8_t size);
+        void countTextCentered(const char* text, int y, uint8_t size);
+
+#ifdef PR32_COMMON_OVERDRAW_MAP
+        // Mirrors this frame's draws pixel for pixel, sprites at their drawn scale.
+        common::OverdrawMap<DISPLAY_WIDTH, DISPLAY_HEIGHT> overdraw;
+        common::OverdrawControls overdrawControls;
+#endif
+
         void updateAliens(unsigned long deltaTime);
         void handleCollisions();
         void enemyShoot();
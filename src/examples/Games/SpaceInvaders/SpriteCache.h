@@ -0,0 +1,10 @@
+#pragma once
+#include "examples/Common/ScaledSpriteCache.h"
+
+namespace spaceinvaders {
+
+// Pre-scaled copies of everything drawn at SPRITE_SCALE: five alien animation
+// frames (one of them a two-layer MultiSprite) and the player ship.
+using SpriteCache = common::ScaledSpriteCache<8, 16, 2>;
+
+}
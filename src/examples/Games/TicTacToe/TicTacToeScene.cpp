@@ -17,39 +17,6 @@ using Color = pr32::graphics::Color;
 using namespace pr32::audio;
 static constexpr float kDefaultAiErrorChance = 0.25f;
 
-static const MusicNote BG_MELODY[] = {
-    makeNote(INSTR_TRIANGLE_PAD, Note::C, 0.6f),
-    makeNote(INSTR_TRIANGLE_PAD, Note::G, 0.6f),
-    makeNote(INSTR_TRIANGLE_PAD, Note::E, 0.6f),
-    makeRest(0.3f),
-    makeNote(INSTR_TRIANGLE_PAD, Note::D, 0.6f),
-    makeNote(INSTR_TRIANGLE_PAD, Note::A, 0.6f),
-    makeNote(INSTR_TRIANGLE_PAD, Note::F, 0.6f),
-    makeRest(0.4f)
-};
-
-static const MusicTrack BG_MUSIC = {
-    BG_MELODY,
-    sizeof(BG_MELODY) / sizeof(MusicNote),
-    true,
-    WaveType::TRIANGLE,
-    0.5f
-};
-
-static const MusicNote WIN_MELODY[] = {
-    makeNote(INSTR_PULSE_LEAD, Note::C, 0.18f),
-    makeNote(INSTR_PULSE_LEAD, Note::E, 0.18f),
-    makeNote(INSTR_PULSE_LEAD, Note::G, 0.30f)
-};
-
-static const MusicTrack WIN_MUSIC = {
-    WIN_MELODY,
-    sizeof(WIN_MELODY) / sizeof(MusicNote),
-    false,
-    WaveType::PULSE,
-    0.5f
-};
-
 // Custom Neon Palette for TicTacToe
 // We use a custom palette to give the game a "Cyberpunk" look.
 // This demonstrates how to use setCustomPalette().
@@ -87,7 +54,7 @@ void TicTacToeScene::init() {
 
     resetGame();
 
-    engine.getMusicPlayer().play(BG_MUSIC);
+    engine.getMusicPlayer().play(music::BG_MUSIC);
 
     static bool seeded = false;
     if (!seeded) {
@@ -130,7 +97,7 @@ void TicTacToeScene::handleInput() {
             return;
         }
         if (input.isButtonPressed(BTN_SELECT)) {
-            engine.getMusicPlayer().play(BG_MUSIC);
+            engine.getMusicPlayer().play(music::BG_MUSIC);
             resetGame();
         }
         return;
@@ -421,7 +388,7 @@ void TicTacToeScene::checkWinCondition() {
 
         engine.getMusicPlayer().stop();
         if (winner == humanPlayer) {
-            engine.getMusicPlayer().play(WIN_MUSIC);
+            engine.getMusicPlayer().play(music::WIN_MUSIC);
         } else {
             pr32::audio::AudioEvent loseEv{};
             loseEv.type = pr32::audio::WaveType::NOISE;
@@ -0,0 +1,1139 @@
+#include "RenderBenchmarkScene.h"
+#include "core/Engine.h"
+#include "Menu/MenuScene.h"
+#include "graphics/Color.h"
+#include "examples/Common/BenchTimer.h"
+#include "examples/Common/SpriteBatch.h"
+#include "examples/Common/FlatSprite.h"
+#include "examples/Common/SpriteRLE.h"
+#include "examples/Common/RowUnpack.h"
+#include "examples/Common/PixelKernels.h"
+#include "examples/Common/PaletteLUT.h"
+#include "examples/Common/IndexedFramebuffer.h"
+#include "examples/Common/StaticLayer.h"
+#include "examples/Common/TextCache.h"
+#include "examples/Games/SpaceInvaders/assets/Background.h"
+#include <cstdio>
+#include <cstring>
+
+namespace pr32 = pixelroot32;
+using Color = pr32::graphics::Color;
+
+extern pr32::core::Engine engine;
+extern MenuScene menuScene;
+
+namespace renderbenchmark {
+
+using common::nowMicros;
+
+namespace {
+
+constexpr uint8_t BTN_LEFT = 2;
+constexpr uint8_t BTN_RIGHT = 3;
+constexpr uint8_t BTN_B = 5;
+
+// 12x8 invader-style test sprite (bit 0 = leftmost pixel).
+const uint16_t BENCH_SPRITE_BITS[] = {
+    0x0F0,
+    0x7FE,
+    0xFFF,
+    0xE67,
+    0xFFF,
+    0x39C,
+    0x666,
+    0xC03
+};
+
+// Eye highlight drawn on top of the body for the two-layer test sprite.
+const uint16_t BENCH_EYES_BITS[] = {
+    0x000,
+    0x000,
+    0x000,
+    0x198,
+    0x000,
+    0x000,
+    0x000,
+    0x000
+};
+
+const pr32::graphics::Sprite BENCH_SPRITE = { BENCH_SPRITE_BITS, 12, 8 };
+
+const pr32::graphics::SpriteLayer BENCH_LAYERS[] = {
+    { BENCH_SPRITE_BITS, Color::Orange },
+    { BENCH_EYES_BITS, Color::White }
+};
+
+const pr32::graphics::MultiSprite BENCH_MULTI_SPRITE = { 12, 8, BENCH_LAYERS, 2 };
+
+// Sparse 16x16 ring: 36 of 256 pixels are opaque, in 26 runs.
+const uint16_t BENCH_RING_BITS[] = {
+    0x0000,
+    0x03C0,
+    0x0C30,
+    0x1008,
+    0x2004,
+    0x2004,
+    0x4002,
+    0x4002,
+    0x4002,
+    0x4002,
+    0x2004,
+    0x2004,
+    0x1008,
+    0x0C30,
+    0x03C0,
+    0x0000
+};
+
+const pr32::graphics::Sprite BENCH_RING = { BENCH_RING_BITS, 16, 16 };
+
+constexpr float BENCH_SCALE = 1.25f;
+constexpr int INSTANCE_COUNTS[] = { 1, 2, 4, 8, 16, 32, 64 };
+constexpr int MAX_INSTANCES = 64;
+
+// Workload area at the top of the screen; the report is drawn below it.
+constexpr int BENCH_AREA_H = 64;
+constexpr int BENCH_COLS = 16;
+constexpr int BENCH_STEP_X = 15;
+constexpr int BENCH_STEP_Y = 16;
+
+// Row unpack workload: 16 rows per case, 16 px wide at 1bpp (the ring) and
+// 32 px wide at 2bpp/4bpp (pseudo-random data). Clipped cases drop 3 columns
+// on the left and 4 on the right, so no case starts on a byte boundary.
+constexpr int UNPACK_ROWS = 16;
+constexpr int UNPACK_REPEAT = 8;
+constexpr int UNPACK_CLIP_LEFT = 3;
+constexpr int UNPACK_CLIP_RIGHT = 4;
+constexpr int UNPACK_MAX_STRIDE = 16;  // 32 px at 4bpp
+
+struct UnpackCase {
+    const char* label;
+    int bpp;
+    int width;
+    bool flipX;
+    bool clip;
+};
+
+const UnpackCase UNPACK_CASES[] = {
+    { "1BPP", 1, 16, false, false },
+    { "1BPP FLIP", 1, 16, true, false },
+    { "1BPP CLIP", 1, 16, false, true },
+    { "1BPP FLIP CLIP", 1, 16, true, true },
+    { "2BPP", 2, 32, false, false },
+    { "2BPP FLIP", 2, 32, true, false },
+    { "2BPP CLIP", 2, 32, false, true },
+    { "2BPP FLIP CLIP", 2, 32, true, true },
+    { "4BPP", 4, 32, false, false },
+    { "4BPP FLIP", 4, 32, true, false },
+    { "4BPP CLIP", 4, 32, false, true },
+    { "4BPP FLIP CLIP", 4, 32, true, true }
+};
+
+// Pixel kernel workload: an 8-line, full-width RGB565 band, repeated 30 times
+// so every row of the report is one 240x240 screen's worth of output.
+constexpr int KERNEL_W = 240;
+constexpr int KERNEL_ROWS = 8;
+constexpr int KERNEL_REPEAT = 30;
+constexpr int KERNEL_PIXELS = KERNEL_W * KERNEL_ROWS;
+constexpr uint16_t KERNEL_KEY = 0xF81F;  // Magenta color key for the masked copy
+
+const char* const KERNEL_LABELS[] = { "FILL", "COPY", "MASKED COPY", "UPSCALE 2X" };
+
+// Palette workload: the kernel band as 4-bit palette indices, about a quarter
+// of them 0 (transparent for sprites), drawn with two palettes in dual mode
+// like the DualPaletteTest scene.
+const uint16_t BENCH_BG_PALETTE[16] = {
+    0x0000, 0xFFFF, 0x0010, 0x001F, 0x07FF, 0x0320, 0x07E0, 0x87F0,
+    0xFFE0, 0xFD20, 0xFC10, 0xF800, 0x8000, 0x8010, 0xF81F, 0x8410
+};
+const uint16_t BENCH_SPRITE_PALETTE[16] = {
+    0x0000, 0xE7DA, 0x8D8F, 0x3A87, 0x0000, 0xE7DA, 0x8D8F, 0x3A87,
+    0x1144, 0xE7DA, 0x8D8F, 0x3A87, 0x1144, 0xE7DA, 0x8D8F, 0x3A87
+};
+
+struct PaletteCase {
+    const char* label;
+    common::PaletteLayer layer;
+    bool swapBytes;  // Big-endian output, as an SPI display takes it
+};
+
+const PaletteCase PALETTE_CASES[] = {
+    { "BACKGROUND", common::PaletteLayer::BACKGROUND, false },
+    { "SPRITE KEYED", common::PaletteLayer::SPRITE, false },
+    { "BACKGROUND SPI", common::PaletteLayer::BACKGROUND, true },
+    { "SPRITE SPI", common::PaletteLayer::SPRITE, true }
+};
+
+// Palette state as the per-pixel path sees it.
+struct PaletteState {
+    const uint16_t* background;
+    const uint16_t* sprite;
+    bool dual;
+    bool swapBytes;
+};
+
+PaletteState paletteState = { BENCH_BG_PALETTE, BENCH_SPRITE_PALETTE, true, false };
+
+// Reference resolve: mode, layer and byte order checked for every pixel. Kept
+// out of line, like a resolve function in the engine's own translation unit.
+#if defined(__GNUC__)
+__attribute__((noinline))
+#endif
+uint16_t resolvePerPixel(uint8_t index, common::PaletteLayer layer) {
+    const uint16_t* palette =
+        paletteState.dual && layer == common::PaletteLayer::SPRITE ? paletteState.sprite : paletteState.background;
+    const uint16_t color = palette[index & (common::PaletteLUT::Size - 1)];
+    return paletteState.swapBytes ? static_cast<uint16_t>((color >> 8) | (color << 8)) : color;
+}
+
+void blitPerPixel(uint16_t* dst, const uint8_t* indices, int count, common::PaletteLayer layer) {
+    for (int i = 0; i < count; ++i) {
+        if (layer == common::PaletteLayer::SPRITE && indices[i] == 0) continue;
+        dst[i] = resolvePerPixel(indices[i], layer);
+    }
+}
+
+// Indexed framebuffer workload: one frame of the kernel band, drawn into
+// kernelTarget[0] as RGB565 or into indexedBand as indices, then streamed to
+// kernelTarget[1] (the display). Sprites are rows of paletteIndices.
+constexpr int FB_RECTS = 12;
+constexpr int FB_SPRITES = 6;
+constexpr int FB_SPRITE_W = 32;
+constexpr int FB_SPRITE_STEP = 40;
+
+struct BenchRect {
+    int x;
+    int y;
+    int w;
+    int h;
+    uint8_t index;
+};
+
+// Everything the pages draw into or read from. About 31 KB, so it is
+// allocated when the scene is entered and freed when it is left rather than
+// kept in static DRAM for the life of the program.
+struct Workloads {
+    common::SpriteBatch<16> benchBatch;
+    common::SpriteInstance benchInstances[MAX_INSTANCES];
+
+#ifdef PIXELROOT32_ENABLE_2BPP_SPRITES
+    common::FlatSprite<16, 8> benchFlat;
+#endif
+
+    common::SpriteRLEBuffer<48, 16> benchRing;
+
+    uint8_t unpackRows1[UNPACK_ROWS][UNPACK_MAX_STRIDE];
+    uint8_t unpackRows2[UNPACK_ROWS][UNPACK_MAX_STRIDE];
+    uint8_t unpackRows4[UNPACK_ROWS][UNPACK_MAX_STRIDE];
+    uint8_t unpackOutRef[32];
+    uint8_t unpackOutLut[32];
+
+    uint16_t kernelSource[KERNEL_PIXELS];
+    uint16_t kernelTarget[2][KERNEL_PIXELS];
+
+    uint8_t paletteIndices[KERNEL_PIXELS];
+    common::PaletteLUT benchPalette;
+
+    BenchRect fbRects[FB_RECTS];
+    common::IndexedFramebuffer<KERNEL_W, KERNEL_ROWS> indexedBand;
+
+    common::StaticLayer<80> staticLayers[3];
+    int staticDirectCalls[3];
+
+    common::TextCache<6, 16, 160> benchText;
+    common::TextCache<1, 16, 160> rasterText;
+};
+
+Workloads* work = nullptr;
+
+const uint8_t* unpackSource(const UnpackCase& c, int row) {
+    if (c.bpp == 1) return work->unpackRows1[row];
+    return c.bpp == 2 ? work->unpackRows2[row] : work->unpackRows4[row];
+}
+
+// Runs one kernel case over the band at dst.
+void runKernelCase(const common::PixelKernels& k, int index, uint16_t* dst) {
+    switch (index) {
+        case 0:
+            k.fill(dst, KERNEL_PIXELS, 0x001F);
+            break;
+        case 1:
+            k.copy(dst, work->kernelSource, KERNEL_PIXELS);
+            break;
+        case 2:
+            k.maskedCopy(dst, work->kernelSource, KERNEL_PIXELS, KERNEL_KEY);
+            break;
+        default:
+            // The top-left 120x4 of the source becomes the whole 240x8 band.
+            k.upscale2x(dst, KERNEL_W, work->kernelSource, KERNEL_W, KERNEL_W / 2, KERNEL_ROWS / 2);
+            break;
+    }
+}
+
+void blitThroughLUT(uint16_t* dst, const PaletteCase& c) {
+    const uint16_t* lut = c.swapBytes ? work->benchPalette.getSwapped(c.layer) : work->benchPalette.get(c.layer);
+    if (c.layer == common::PaletteLayer::SPRITE) {
+        common::blitIndexedKeyed(dst, work->paletteIndices, KERNEL_PIXELS, lut);
+    } else {
+        common::blitIndexed(dst, work->paletteIndices, KERNEL_PIXELS, lut);
+    }
+}
+
+const char* const FB_LABELS[] = { "CLEAR", "RECTS", "SPRITE ROWS", "PRESENT" };
+
+// RGB565 frame: every draw resolves its colors through the layer tables.
+void drawFrameStageRGB565(int stage) {
+    const common::PixelKernels& k = common::pixelKernels();
+    const uint16_t* background = work->benchPalette.get(common::PaletteLayer::BACKGROUND);
+    const uint16_t* sprites = work->benchPalette.get(common::PaletteLayer::SPRITE);
+    uint16_t* band = work->kernelTarget[0];
+    switch (stage) {
+        case 0:
+            k.fill(band, KERNEL_PIXELS, background[0]);
+            break;
+        case 1:
+            for (const BenchRect& r : work->fbRects) {
+                for (int y = r.y; y < r.y + r.h; ++y) k.fill(band + y * KERNEL_W + r.x, r.w, background[r.index]);
+            }
+            break;
+        case 2:
+            for (int s = 0; s < FB_SPRITES; ++s) {
+                for (int y = 0; y < KERNEL_ROWS; ++y) {
+                    common::blitIndexedKeyed(band + y * KERNEL_W + s * FB_SPRITE_STEP,
+                                             work->paletteIndices + y * KERNEL_W + s * FB_SPRITE_W, FB_SPRITE_W, sprites);
+                }
+            }
+            break;
+        default:
+            k.copy(work->kernelTarget[1], band, KERNEL_PIXELS);
+            break;
+    }
+}
+
+// Indexed frame: draws store indices; colors are looked up once, at present.
+void drawFrameStageIndexed(int stage) {
+    switch (stage) {
+        case 0:
+            work->indexedBand.clear(0);
+            break;
+        case 1:
+            for (const BenchRect& r : work->fbRects) work->indexedBand.fillRect(r.x, r.y, r.w, r.h, r.index);
+            break;
+        case 2:
+            for (int s = 0; s < FB_SPRITES; ++s) {
+                for (int y = 0; y < KERNEL_ROWS; ++y) {
+                    work->indexedBand.drawRow(s * FB_SPRITE_STEP, y, work->paletteIndices + y * KERNEL_W + s * FB_SPRITE_W,
+                                        FB_SPRITE_W, common::PaletteLUT::SpriteBase);
+                }
+            }
+            break;
+        default:
+            work->indexedBand.present(work->benchPalette.getFrameTable(), [](int y, int rows, const uint16_t* pixels) {
+                std::memcpy(work->kernelTarget[1] + y * KERNEL_W, pixels, static_cast<size_t>(rows * KERNEL_W) * sizeof(uint16_t));
+            });
+            break;
+    }
+}
+
+// Static layer workload: the three backgrounds that never change, painted
+// full screen the way their scenes paint them.
+template <typename Canvas>
+void paintStarfield(Canvas& canvas) {
+    canvas.drawFilledRectangle(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT, Color::Black);
+    for (int i = 0; i < background_assets::STAR_COUNT; ++i) {
+        canvas.drawPixel(static_cast<int>(background_assets::STAR_X[i]),
+                         static_cast<int>(background_assets::STAR_Y[i]), Color::White);
+    }
+}
+
+template <typename Canvas>
+void paintPongCourt(Canvas& canvas) {
+    constexpr int top = (DISPLAY_HEIGHT - 160) / 2;
+    constexpr int bottom = top + 160;
+    canvas.drawFilledRectangle(0, 0, DISPLAY_WIDTH, top, Color::DarkGray);
+    canvas.drawFilledRectangle(0, bottom, DISPLAY_WIDTH, DISPLAY_HEIGHT - bottom, Color::DarkGray);
+    canvas.drawLine(0, top, DISPLAY_WIDTH - 1, top, Color::White);
+    canvas.drawLine(0, bottom, DISPLAY_WIDTH - 1, bottom, Color::White);
+    for (int y = 0; y < DISPLAY_HEIGHT; y += 15) {
+        canvas.drawLine(DISPLAY_WIDTH / 2, y, DISPLAY_WIDTH / 2, y + 10 > DISPLAY_HEIGHT ? DISPLAY_HEIGHT : y + 10,
+                        Color::LightGray);
+    }
+}
+
+template <typename Canvas>
+void paintSwatches(Canvas& canvas) {
+    static const Color SWATCHES[] = {
+        Color::Navy, Color::Blue, Color::Cyan, Color::DarkGreen,
+        Color::Green, Color::LightGreen, Color::Yellow, Color::Orange,
+        Color::LightRed, Color::Red, Color::DarkRed, Color::Purple
+    };
+    canvas.drawFilledRectangle(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT, Color::Black);
+    for (int i = 0; i < 12; ++i) {
+        canvas.drawFilledRectangle(10 + (i % 4) * 40, 10 + (i / 4) * 40, 30, 30, SWATCHES[i]);
+    }
+    for (int i = 0; i < 8; ++i) {
+        for (int j = 0; j < 8; ++j) {
+            if ((i + j) % 2 == 0) canvas.drawFilledRectangle(170 + i * 8, 130 + j * 8, 8, 8, Color::Cyan);
+        }
+    }
+}
+
+template <typename Canvas>
+void paintStaticCase(int index, Canvas& canvas) {
+    switch (index) {
+        case 0:
+            paintStarfield(canvas);
+            break;
+        case 1:
+            paintPongCourt(canvas);
+            break;
+        default:
+            paintSwatches(canvas);
+            break;
+    }
+}
+
+const char* const STATIC_LABELS[] = { "STARFIELD", "PONG COURT", "SWATCHES" };
+
+// Counts the Renderer calls a paint function makes.
+struct CallCounter {
+    int calls = 0;
+    void drawFilledRectangle(int, int, int, int, Color) { ++calls; }
+    void drawLine(int, int, int, int, Color) { ++calls; }
+    void drawPixel(int, int, Color) { ++calls; }
+};
+
+// Rasterizes axis-aligned primitives into one kernel band (rows y0 to
+// y0 + KERNEL_ROWS), so init() can compare replay and direct output band by
+// band without a full-screen buffer.
+struct BandCanvas {
+    uint16_t* band;
+    int y0;
+
+    void drawFilledRectangle(int x, int y, int w, int h, Color color) {
+        const int x1 = x + w > KERNEL_W ? KERNEL_W : x + w;
+        const int yEnd = y + h > y0 + KERNEL_ROWS ? y0 + KERNEL_ROWS : y + h;
+        for (int py = y < y0 ? y0 : y; py < yEnd; ++py) {
+            for (int px = x < 0 ? 0 : x; px < x1; ++px) band[(py - y0) * KERNEL_W + px] = static_cast<uint16_t>(color);
+        }
+    }
+
+    // Lines in these backgrounds are axis-aligned; endpoints are included.
+    void drawLine(int xa, int ya, int xb, int yb, Color color) {
+        drawFilledRectangle(xa < xb ? xa : xb, ya < yb ? ya : yb, (xa < xb ? xb - xa : xa - xb) + 1,
+                            (ya < yb ? yb - ya : ya - yb) + 1, color);
+    }
+
+    void drawPixel(int x, int y, Color color) { drawFilledRectangle(x, y, 1, 1, color); }
+};
+
+// Text cache workload: the HUD strings of Space Invaders and Pong, drawn in
+// the top band. benchText stays warm; rasterText holds one entry, so every
+// string misses there and is rasterized again.
+struct TextCase {
+    const char* label;
+    const char* text;
+    uint8_t size;
+};
+
+const TextCase TEXT_CASES[] = {
+    { "SCORE X1", "SCORE 0420", 1 },
+    { "LIVES X1", "LIVES 3", 1 },
+    { "PRESS A X1", "PRESS A TO START", 1 },
+    { "PONG SCORE X2", "3 : 5", 2 },
+    { "GAME OVER X2", "GAME OVER", 2 },
+    { "YOU WIN X2", "YOU WIN!", 2 }
+};
+
+int textX(int index) { return index < 3 ? 4 : 124; }
+int textY(int index) { return 2 + (index % 3) * 20; }
+
+// Rows of a drawn string, one at a time: records which pixels of row `row`
+// the cache filled, and whether it fell back to the renderer.
+constexpr int TEXT_LINE_W = 16 * 6 * 2;  // MaxChars glyphs of 5+1 px at size 2
+
+struct TextRowCanvas {
+    uint8_t* line;
+    int row;
+    bool fellBack;
+
+    void drawFilledRectangle(int x, int y, int w, int h, Color) {
+        if (row < y || row >= y + h) return;
+        for (int px = x < 0 ? 0 : x; px < x + w && px < TEXT_LINE_W; ++px) line[px] = 1;
+    }
+
+    void drawText(const char*, int, int, Color, uint8_t) { fellBack = true; }
+    void drawTextCentered(const char*, int, Color, uint8_t) { fellBack = true; }
+    int getWidth() const { return TEXT_LINE_W; }
+};
+
+// Reference decoder: one shift and mask per pixel, as the bitmap blitters do.
+void unpackRowPerPixel(const uint8_t* bytes, int bpp, int width, int first, int count,
+                       bool flipX, uint8_t* out) {
+    const uint8_t mask = static_cast<uint8_t>((1u << bpp) - 1);
+    for (int i = 0; i < count; ++i) {
+        const int x = flipX ? width - 1 - (first + i) : first + i;
+        const int bit = x * bpp;
+        out[i] = static_cast<uint8_t>((bytes[bit >> 3] >> (bit & 7)) & mask);
+    }
+}
+
+struct PageInfo {
+    const char* title;
+    const char* referenceLabel;
+    const char* optimizedLabel;
+    const char* setupLabel;
+};
+
+const PageInfo PAGES[] = {
+    { "SPRITE BATCH", "SCALED", "BATCH", "PREPARE" },
+    { "MULTISPRITE FLATTEN", "LAYERED", "FLAT", "FLATTEN" },
+    { "SPRITE RLE", "BITMAP", "SPANS", "ENCODE" },
+    { "ROW UNPACK", "PIXEL", "LUT", "" },
+    { "PIXEL KERNELS", "SCALAR", "SIMD", "" },
+    { "PALETTE LUT", "PIXEL", "LUT", "REBUILD" },
+    { "INDEXED FRAMEBUFFER", "RGB565", "INDEX", "RECOLOR" },
+    { "STATIC LAYER", "DIRECT", "REPLAY", "RECORD" },
+    { "TEXT CACHE", "TEXT", "CACHE", "FIRST DRAW" }
+};
+
+} // namespace
+
+RenderBenchmarkScene::RenderBenchmarkScene()
+    : page(Page::SPRITE_BATCH), flattenMismatches(-1), unpackMismatches(0),
+      kernelMismatches(0), paletteMismatches(0), framebufferMismatches(0), staticMismatches(0),
+      textMismatches(0) {
+    resetTotals();
+    hasReport = false;
+    setupAvg = 0;
+    for (int i = 0; i < MaxRows; ++i) {
+        referenceAvg[i] = 0;
+        optimizedAvg[i] = 0;
+    }
+}
+
+RenderBenchmarkScene::~RenderBenchmarkScene() {
+    delete work;
+    work = nullptr;
+}
+
+void RenderBenchmarkScene::init() {
+    pr32::graphics::setPalette(pr32::graphics::PaletteType::PR32);
+
+    if (!work) work = new Workloads();
+
+    for (int i = 0; i < MAX_INSTANCES; ++i) {
+        work->benchInstances[i].x = static_cast<int16_t>((i % BENCH_COLS) * BENCH_STEP_X);
+        work->benchInstances[i].y = static_cast<int16_t>((i / BENCH_COLS) * BENCH_STEP_Y);
+        work->benchInstances[i].flipX = (i & 1) != 0;
+    }
+
+#ifdef PIXELROOT32_ENABLE_2BPP_SPRITES
+    work->benchFlat.build(BENCH_MULTI_SPRITE);
+    flattenMismatches = work->benchFlat.countMismatches(BENCH_MULTI_SPRITE);
+#endif
+
+    uint32_t seed = 0x1234567u;
+    for (int row = 0; row < UNPACK_ROWS; ++row) {
+        work->unpackRows1[row][0] = static_cast<uint8_t>(BENCH_RING_BITS[row] & 0xFF);
+        work->unpackRows1[row][1] = static_cast<uint8_t>(BENCH_RING_BITS[row] >> 8);
+        for (int i = 0; i < UNPACK_MAX_STRIDE; ++i) {
+            seed = seed * 1103515245u + 12345u;
+            work->unpackRows2[row][i] = static_cast<uint8_t>(seed >> 16);
+            seed = seed * 1103515245u + 12345u;
+            work->unpackRows4[row][i] = static_cast<uint8_t>(seed >> 16);
+        }
+    }
+
+    unpackMismatches = 0;
+    for (const UnpackCase& c : UNPACK_CASES) {
+        const int first = c.clip ? UNPACK_CLIP_LEFT : 0;
+        const int count = c.width - (c.clip ? UNPACK_CLIP_LEFT + UNPACK_CLIP_RIGHT : 0);
+        for (int row = 0; row < UNPACK_ROWS; ++row) {
+            unpackRowPerPixel(unpackSource(c, row), c.bpp, c.width, first, count, c.flipX, work->unpackOutRef);
+            common::unpackRow(unpackSource(c, row), c.bpp, c.width, first, count, c.flipX, work->unpackOutLut);
+            for (int i = 0; i < count; ++i) {
+                if (work->unpackOutRef[i] != work->unpackOutLut[i]) ++unpackMismatches;
+            }
+        }
+    }
+
+    for (int i = 0; i < KERNEL_PIXELS; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        // Roughly a quarter of the source is the color key.
+        work->kernelSource[i] = ((seed >> 16) & 3) == 0 ? KERNEL_KEY : static_cast<uint16_t>(seed >> 8);
+    }
+
+    kernelMismatches = 0;
+    for (int index = 0; index < KernelCases; ++index) {
+        for (int i = 0; i < KERNEL_PIXELS; ++i) {
+            work->kernelTarget[0][i] = work->kernelTarget[1][i] = static_cast<uint16_t>(i);
+        }
+        runKernelCase(common::scalarPixelKernels(), index, work->kernelTarget[0]);
+        runKernelCase(common::pixelKernels(), index, work->kernelTarget[1]);
+        for (int i = 0; i < KERNEL_PIXELS; ++i) {
+            if (work->kernelTarget[0][i] != work->kernelTarget[1][i]) ++kernelMismatches;
+        }
+    }
+
+    for (int i = 0; i < KERNEL_PIXELS; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        work->paletteIndices[i] = ((seed >> 16) & 3) == 0 ? 0 : static_cast<uint8_t>((seed >> 20) & 15);
+    }
+    work->benchPalette.setBackgroundPalette(BENCH_BG_PALETTE);
+    work->benchPalette.setSpritePalette(BENCH_SPRITE_PALETTE);
+    work->benchPalette.enableDualPaletteMode(true);
+
+    paletteMismatches = 0;
+    for (const PaletteCase& c : PALETTE_CASES) {
+        for (int i = 0; i < KERNEL_PIXELS; ++i) {
+            work->kernelTarget[0][i] = work->kernelTarget[1][i] = static_cast<uint16_t>(i);
+        }
+        paletteState.swapBytes = c.swapBytes;
+        blitPerPixel(work->kernelTarget[0], work->paletteIndices, KERNEL_PIXELS, c.layer);
+        blitThroughLUT(work->kernelTarget[1], c);
+        for (int i = 0; i < KERNEL_PIXELS; ++i) {
+            if (work->kernelTarget[0][i] != work->kernelTarget[1][i]) ++paletteMismatches;
+        }
+    }
+
+    for (BenchRect& r : work->fbRects) {
+        seed = seed * 1103515245u + 12345u;
+        r.w = 8 + static_cast<int>((seed >> 16) % 64);
+        r.x = static_cast<int>((seed >> 8) % static_cast<uint32_t>(KERNEL_W - r.w));
+        r.h = 1 + static_cast<int>((seed >> 24) % KERNEL_ROWS);
+        r.y = static_cast<int>((seed >> 4) % static_cast<uint32_t>(KERNEL_ROWS - r.h + 1));
+        r.index = static_cast<uint8_t>(1 + (seed >> 28) % 15);
+    }
+
+    // Both frames end up on the display; compare what each one put there.
+    uint16_t* const display = work->kernelTarget[1];
+    for (int stage = 0; stage < FramebufferCases; ++stage) drawFrameStageRGB565(stage);
+    std::memcpy(work->kernelTarget[0], display, sizeof(work->kernelTarget[0]));
+    for (int stage = 0; stage < FramebufferCases; ++stage) drawFrameStageIndexed(stage);
+    framebufferMismatches = 0;
+    for (int i = 0; i < KERNEL_PIXELS; ++i) {
+        if (work->kernelTarget[0][i] != display[i]) ++framebufferMismatches;
+    }
+
+    staticMismatches = 0;
+    for (int index = 0; index < StaticCases; ++index) {
+        CallCounter counter;
+        paintStaticCase(index, counter);
+        work->staticDirectCalls[index] = counter.calls;
+
+        common::StaticLayer<80>& layer = work->staticLayers[index];
+        layer.begin();
+        paintStaticCase(index, layer);
+        layer.end();
+
+        for (int y0 = 0; y0 < DISPLAY_HEIGHT; y0 += KERNEL_ROWS) {
+            BandCanvas direct = { work->kernelTarget[0], y0 };
+            BandCanvas replay = { work->kernelTarget[1], y0 };
+            paintStaticCase(index, direct);
+            if (!layer.draw(replay)) paintStaticCase(index, replay);
+            for (int i = 0; i < KERNEL_PIXELS; ++i) {
+                if (work->kernelTarget[0][i] != work->kernelTarget[1][i]) ++staticMismatches;
+            }
+        }
+    }
+
+    // Cached runs against the glyph bits, row by row.
+    textMismatches = 0;
+    work->benchText.clear();
+    const pr32::graphics::Font* font = pr32::graphics::FontManager::getDefaultFont();
+    for (int index = 0; index < TextCases && font; ++index) {
+        const TextCase& c = TEXT_CASES[index];
+        const int advance = (font->glyphWidth + font->spacing) * c.size;
+        for (int row = 0; row < font->glyphHeight * c.size; ++row) {
+            uint8_t cached[TEXT_LINE_W] = {};
+            uint8_t expected[TEXT_LINE_W] = {};
+            TextRowCanvas canvas = { cached, row, false };
+            work->benchText.drawText(canvas, c.text, 0, 0, Color::White, c.size);
+            if (canvas.fellBack) ++textMismatches;
+
+            const int glyphRow = row / c.size;
+            for (int i = 0; c.text[i]; ++i) {
+                const unsigned char ch = static_cast<unsigned char>(c.text[i]);
+                if (ch < font->firstChar || ch > font->lastChar) continue;
+                const uint16_t bits = font->glyphs[ch - font->firstChar].data[glyphRow];
+                for (int gx = 0; gx < font->glyphWidth; ++gx) {
+                    if (!((bits >> gx) & 1)) continue;
+                    for (int s = 0; s < c.size; ++s) expected[i * advance + gx * c.size + s] = 1;
+                }
+            }
+            for (int px = 0; px < TEXT_LINE_W; ++px) {
+                if (cached[px] != expected[px]) ++textMismatches;
+            }
+        }
+    }
+
+    selectPage(Page::SPRITE_BATCH);
+}
+
+void RenderBenchmarkScene::selectPage(Page next) {
+    page = next;
+    resetTotals();
+    hasReport = false;
+}
+
+void RenderBenchmarkScene::resetTotals() {
+    for (int i = 0; i < MaxRows; ++i) {
+        referenceTotal[i] = 0;
+        optimizedTotal[i] = 0;
+    }
+    setupTotal = 0;
+    setupRuns = 0;
+    samples = 0;
+}
+
+void RenderBenchmarkScene::update(unsigned long deltaTime) {
+    Scene::update(deltaTime);
+
+    auto& input = engine.getInputManager();
+    const int pageCount = static_cast<int>(Page::COUNT);
+    int index = static_cast<int>(page);
+    if (input.isButtonPressed(BTN_RIGHT)) {
+        selectPage(static_cast<Page>((index + 1) % pageCount));
+    } else if (input.isButtonPressed(BTN_LEFT)) {
+        selectPage(static_cast<Page>((index + pageCount - 1) % pageCount));
+    } else if (input.isButtonPressed(BTN_B)) {
+        // Back to the menu; the workloads are built again on the next visit.
+        delete work;
+        work = nullptr;
+        engine.setScene(&menuScene);
+    }
+}
+
+void RenderBenchmarkScene::runSpriteBatchBench(pr32::graphics::Renderer& renderer) {
+    for (int step = 0; step < InstanceSteps; ++step) {
+        const int count = INSTANCE_COUNTS[step];
+
+        unsigned long start = nowMicros();
+        for (int i = 0; i < count; ++i) {
+            const common::SpriteInstance& inst = work->benchInstances[i];
+            renderer.drawSprite(BENCH_SPRITE, inst.x, inst.y, BENCH_SCALE, BENCH_SCALE,
+                                Color::Orange, inst.flipX);
+        }
+        referenceTotal[step] += nowMicros() - start;
+
+        // Prepare is timed on its own so the report can show both the
+        // amortized (prepared once) and the per-frame-prepare crossover.
+        start = nowMicros();
+        work->benchBatch.prepare(BENCH_SPRITE, BENCH_SCALE, BENCH_SCALE);
+        setupTotal += nowMicros() - start;
+        ++setupRuns;
+
+        start = nowMicros();
+        work->benchBatch.draw(renderer, work->benchInstances, count, Color::Orange);
+        optimizedTotal[step] += nowMicros() - start;
+    }
+}
+
+void RenderBenchmarkScene::runFlattenBench(pr32::graphics::Renderer& renderer) {
+#ifdef PIXELROOT32_ENABLE_2BPP_SPRITES
+    for (int step = 0; step < InstanceSteps; ++step) {
+        const int count = INSTANCE_COUNTS[step];
+
+        unsigned long start = nowMicros();
+        for (int i = 0; i < count; ++i) {
+            renderer.drawMultiSprite(BENCH_MULTI_SPRITE, work->benchInstances[i].x, work->benchInstances[i].y);
+        }
+        referenceTotal[step] += nowMicros() - start;
+
+        start = nowMicros();
+        work->benchFlat.build(BENCH_MULTI_SPRITE);
+        setupTotal += nowMicros() - start;
+        ++setupRuns;
+
+        start = nowMicros();
+        for (int i = 0; i < count; ++i) {
+            work->benchFlat.draw(renderer, work->benchInstances[i].x, work->benchInstances[i].y);
+        }
+        optimizedTotal[step] += nowMicros() - start;
+    }
+#else
+    (void)renderer;
+#endif
+}
+
+void RenderBenchmarkScene::runRLEBench(pr32::graphics::Renderer& renderer) {
+    for (int step = 0; step < InstanceSteps; ++step) {
+        const int count = INSTANCE_COUNTS[step];
+
+        unsigned long start = nowMicros();
+        for (int i = 0; i < count; ++i) {
+            const common::SpriteInstance& inst = work->benchInstances[i];
+            renderer.drawSprite(BENCH_RING, inst.x, inst.y, Color::Cyan, inst.flipX);
+        }
+        referenceTotal[step] += nowMicros() - start;
+
+        start = nowMicros();
+        work->benchRing.build(BENCH_RING);
+        setupTotal += nowMicros() - start;
+        ++setupRuns;
+
+        start = nowMicros();
+        for (int i = 0; i < count; ++i) {
+            const common::SpriteInstance& inst = work->benchInstances[i];
+            common::drawSprite(renderer, work->benchRing.get(), inst.x, inst.y, Color::Cyan, inst.flipX);
+        }
+        optimizedTotal[step] += nowMicros() - start;
+    }
+}
+
+void RenderBenchmarkScene::runUnpackBench() {
+    for (int index = 0; index < UnpackCases; ++index) {
+        const UnpackCase& c = UNPACK_CASES[index];
+        const int first = c.clip ? UNPACK_CLIP_LEFT : 0;
+        const int count = c.width - (c.clip ? UNPACK_CLIP_LEFT + UNPACK_CLIP_RIGHT : 0);
+
+        unsigned long start = nowMicros();
+        for (int r = 0; r < UNPACK_REPEAT; ++r) {
+            for (int row = 0; row < UNPACK_ROWS; ++row) {
+                unpackRowPerPixel(unpackSource(c, row), c.bpp, c.width, first, count, c.flipX, work->unpackOutRef);
+            }
+        }
+        referenceTotal[index] += nowMicros() - start;
+
+        start = nowMicros();
+        for (int r = 0; r < UNPACK_REPEAT; ++r) {
+            for (int row = 0; row < UNPACK_ROWS; ++row) {
+                common::unpackRow(unpackSource(c, row), c.bpp, c.width, first, count, c.flipX, work->unpackOutLut);
+            }
+        }
+        optimizedTotal[index] += nowMicros() - start;
+    }
+}
+
+void RenderBenchmarkScene::runKernelBench() {
+    const common::PixelKernels& scalar = common::scalarPixelKernels();
+    const common::PixelKernels& simd = common::pixelKernels();
+
+    for (int index = 0; index < KernelCases; ++index) {
+        unsigned long start = nowMicros();
+        for (int r = 0; r < KERNEL_REPEAT; ++r) runKernelCase(scalar, index, work->kernelTarget[0]);
+        referenceTotal[index] += nowMicros() - start;
+
+        start = nowMicros();
+        for (int r = 0; r < KERNEL_REPEAT; ++r) runKernelCase(simd, index, work->kernelTarget[1]);
+        optimizedTotal[index] += nowMicros() - start;
+    }
+}
+
+void RenderBenchmarkScene::runPaletteBench() {
+    // A palette switch, as a scene would make it; the tables are rebuilt here.
+    unsigned long start = nowMicros();
+    work->benchPalette.setSpritePalette(BENCH_SPRITE_PALETTE);
+    setupTotal += nowMicros() - start;
+    ++setupRuns;
+
+    for (int index = 0; index < PaletteCases; ++index) {
+        const PaletteCase& c = PALETTE_CASES[index];
+        paletteState.swapBytes = c.swapBytes;
+
+        start = nowMicros();
+        for (int r = 0; r < KERNEL_REPEAT; ++r) blitPerPixel(work->kernelTarget[0], work->paletteIndices, KERNEL_PIXELS, c.layer);
+        referenceTotal[index] += nowMicros() - start;
+
+        start = nowMicros();
+        for (int r = 0; r < KERNEL_REPEAT; ++r) blitThroughLUT(work->kernelTarget[1], c);
+        optimizedTotal[index] += nowMicros() - start;
+    }
+}
+
+void RenderBenchmarkScene::runFramebufferBench() {
+    // Palette flash: the indexed frame only needs new tables.
+    unsigned long start = nowMicros();
+    work->benchPalette.setBackgroundPalette(BENCH_BG_PALETTE);
+    setupTotal += nowMicros() - start;
+    ++setupRuns;
+
+    for (int stage = 0; stage < FramebufferCases; ++stage) {
+        start = nowMicros();
+        for (int r = 0; r < KERNEL_REPEAT; ++r) drawFrameStageRGB565(stage);
+        referenceTotal[stage] += nowMicros() - start;
+
+        start = nowMicros();
+        for (int r = 0; r < KERNEL_REPEAT; ++r) drawFrameStageIndexed(stage);
+        optimizedTotal[stage] += nowMicros() - start;
+    }
+}
+
+void RenderBenchmarkScene::runStaticLayerBench(pr32::graphics::Renderer& renderer) {
+    for (int index = 0; index < StaticCases; ++index) {
+        common::StaticLayer<80>& layer = work->staticLayers[index];
+
+        unsigned long start = nowMicros();
+        layer.begin();
+        paintStaticCase(index, layer);
+        layer.end();
+        setupTotal += nowMicros() - start;
+        ++setupRuns;
+
+        start = nowMicros();
+        paintStaticCase(index, renderer);
+        referenceTotal[index] += nowMicros() - start;
+
+        start = nowMicros();
+        if (!layer.draw(renderer)) paintStaticCase(index, renderer);
+        optimizedTotal[index] += nowMicros() - start;
+    }
+
+    // The backgrounds are full screen; give the report its black area back.
+    renderer.drawFilledRectangle(0, BENCH_AREA_H, DISPLAY_WIDTH, DISPLAY_HEIGHT - BENCH_AREA_H, Color::Black);
+}
+
+void RenderBenchmarkScene::runTextCacheBench(pr32::graphics::Renderer& renderer) {
+    unsigned long start = nowMicros();
+    for (int index = 0; index < TextCases; ++index) {
+        const TextCase& c = TEXT_CASES[index];
+        work->rasterText.drawText(renderer, c.text, textX(index), textY(index), Color::Yellow, c.size);
+    }
+    setupTotal += nowMicros() - start;
+    ++setupRuns;
+
+    for (int index = 0; index < TextCases; ++index) {
+        const TextCase& c = TEXT_CASES[index];
+
+        start = nowMicros();
+        renderer.drawText(c.text, textX(index), textY(index), Color::White, c.size);
+        referenceTotal[index] += nowMicros() - start;
+
+        start = nowMicros();
+        work->benchText.drawText(renderer, c.text, textX(index), textY(index), Color::White, c.size);
+        optimizedTotal[index] += nowMicros() - start;
+    }
+}
+
+const char* RenderBenchmarkScene::caseLabel(int index) const {
+    if (page == Page::ROW_UNPACK) return UNPACK_CASES[index].label;
+    if (page == Page::STATIC_LAYER) return STATIC_LABELS[index];
+    if (page == Page::TEXT_CACHE) return TEXT_CASES[index].label;
+    if (page == Page::INDEXED_FRAMEBUFFER) return FB_LABELS[index];
+    return page == Page::PALETTE_LUT ? PALETTE_CASES[index].label : KERNEL_LABELS[index];
+}
+
+int RenderBenchmarkScene::caseCount() const {
+    if (page == Page::ROW_UNPACK) return UnpackCases;
+    if (page == Page::INDEXED_FRAMEBUFFER) return FramebufferCases;
+    if (page == Page::STATIC_LAYER) return StaticCases;
+    if (page == Page::TEXT_CACHE) return TextCases;
+    return page == Page::PALETTE_LUT ? PaletteCases : KernelCases;
+}
+
+int RenderBenchmarkScene::caseMismatches() const {
+    if (page == Page::ROW_UNPACK) return unpackMismatches;
+    if (page == Page::INDEXED_FRAMEBUFFER) return framebufferMismatches;
+    if (page == Page::STATIC_LAYER) return staticMismatches;
+    if (page == Page::TEXT_CACHE) return textMismatches;
+    return page == Page::PALETTE_LUT ? paletteMismatches : kernelMismatches;
+}
+
+void RenderBenchmarkScene::drawCaseReport(pr32::graphics::Renderer& renderer, int y) {
+    const PageInfo& info = PAGES[static_cast<int>(page)];
+    char line[48];
+
+    if (page == Page::PIXEL_KERNELS) {
+        std::snprintf(line, sizeof(line), "KERNELS: %s", common::pixelKernels().name);
+        renderer.drawText(line, 8, y, Color::Yellow, 1);
+        y += 10;
+    }
+
+    const char* unit = page == Page::ROW_UNPACK ? "x128 ROWS" : "240x240";
+    if (page == Page::TEXT_CACHE) unit = "PER STRING";
+    std::snprintf(line, sizeof(line), "%-14s %-6s %-4s(us)", unit, info.referenceLabel, info.optimizedLabel);
+    renderer.drawText(line, 8, y, Color::Cyan, 1);
+    y += 10;
+
+    for (int index = 0; index < caseCount(); ++index) {
+        std::snprintf(line, sizeof(line), "%-14s %5lu  %5lu", caseLabel(index),
+                      referenceAvg[index], optimizedAvg[index]);
+        const Color color = optimizedAvg[index] < referenceAvg[index] ? Color::White : Color::Red;
+        renderer.drawText(line, 8, y, color, 1);
+        y += 10;
+    }
+
+    y += 4;
+    if (page == Page::PALETTE_LUT) {
+        std::snprintf(line, sizeof(line), "%s: %lu us", info.setupLabel, setupAvg);
+        renderer.drawText(line, 8, y, Color::Yellow, 1);
+        y += 10;
+    } else if (page == Page::INDEXED_FRAMEBUFFER) {
+        // Recoloring an RGB565 frame means drawing it again.
+        unsigned long redraw = 0;
+        for (int index = 0; index < FramebufferCases; ++index) redraw += referenceAvg[index];
+        std::snprintf(line, sizeof(line), "%s: %lu us (REDRAW %lu)", info.setupLabel, setupAvg, redraw);
+        renderer.drawText(line, 8, y, Color::Yellow, 1);
+        y += 10;
+        std::snprintf(line, sizeof(line), "240x240: %d KB -> %d KB", DISPLAY_WIDTH * DISPLAY_HEIGHT * 2 / 1024,
+                      (DISPLAY_WIDTH * DISPLAY_HEIGHT + work->indexedBand.getStripBytes()) / 1024);
+        renderer.drawText(line, 8, y, Color::Yellow, 1);
+        y += 10;
+    } else if (page == Page::STATIC_LAYER) {
+        std::snprintf(line, sizeof(line), "%s: %lu us", info.setupLabel, setupAvg);
+        renderer.drawText(line, 8, y, Color::Yellow, 1);
+        y += 10;
+        // A replay only saves calls where recorded primitives merged.
+        std::snprintf(line, sizeof(line), "CALLS: %d/%d %d/%d %d/%d",
+                      work->staticDirectCalls[0], work->staticLayers[0].getRectCount(),
+                      work->staticDirectCalls[1], work->staticLayers[1].getRectCount(),
+                      work->staticDirectCalls[2], work->staticLayers[2].getRectCount());
+        renderer.drawText(line, 8, y, Color::Yellow, 1);
+        y += 10;
+    } else if (page == Page::TEXT_CACHE) {
+        std::snprintf(line, sizeof(line), "%s: %lu us (6 STRINGS)", info.setupLabel, setupAvg);
+        renderer.drawText(line, 8, y, Color::Yellow, 1);
+        y += 10;
+        // A cached string is one fill per run, not one blit.
+        int length = std::snprintf(line, sizeof(line), "RUNS:");
+        for (int index = 0; index < TextCases && length < static_cast<int>(sizeof(line)); ++index) {
+            const TextCase& c = TEXT_CASES[index];
+            length += std::snprintf(line + length, sizeof(line) - length, " %d",
+                                    work->benchText.getRunCount(c.text, Color::White, c.size));
+        }
+        renderer.drawText(line, 8, y, Color::Yellow, 1);
+        y += 10;
+    }
+    const int mismatches = caseMismatches();
+    if (mismatches == 0) {
+        std::snprintf(line, sizeof(line), "VALIDATE: IDENTICAL");
+    } else {
+        std::snprintf(line, sizeof(line), "VALIDATE: %d PX DIFFER", mismatches);
+    }
+    renderer.drawText(line, 8, y, mismatches == 0 ? Color::Green : Color::Red, 1);
+}
+
+void RenderBenchmarkScene::drawReport(pr32::graphics::Renderer& renderer) {
+    const PageInfo& info = PAGES[static_cast<int>(page)];
+    char line[48];
+    int y = BENCH_AREA_H + 6;
+
+    std::snprintf(line, sizeof(line), "< %s >", info.title);
+    renderer.drawTextCentered(line, y, Color::White, 1);
+    y += 12;
+
+#ifndef PIXELROOT32_ENABLE_2BPP_SPRITES
+    if (page == Page::MULTISPRITE_FLATTEN) {
+        renderer.drawTextCentered("NEEDS 2BPP SPRITES", y, Color::Red, 1);
+        return;
+    }
+#endif
+
+    if (!hasReport) {
+        renderer.drawTextCentered("MEASURING...", y, Color::Gray, 1);
+        return;
+    }
+
+    if (page == Page::ROW_UNPACK || page == Page::PIXEL_KERNELS || page == Page::PALETTE_LUT ||
+        page == Page::INDEXED_FRAMEBUFFER || page == Page::STATIC_LAYER || page == Page::TEXT_CACHE) {
+        drawCaseReport(renderer, y);
+        return;
+    }
+
+    std::snprintf(line, sizeof(line), "N    %-7s %-7s(us)", info.referenceLabel, info.optimizedLabel);
+    renderer.drawText(line, 20, y, Color::Cyan, 1);
+    y += 10;
+
+    int crossoverAmortized = -1;
+    int crossoverPerFrame = -1;
+    for (int step = 0; step < InstanceSteps; ++step) {
+        const int count = INSTANCE_COUNTS[step];
+        std::snprintf(line, sizeof(line), "%-4d %6lu  %6lu", count, referenceAvg[step], optimizedAvg[step]);
+        renderer.drawText(line, 20, y, Color::White, 1);
+        y += 10;
+
+        if (crossoverAmortized < 0 && optimizedAvg[step] < referenceAvg[step]) {
+            crossoverAmortized = count;
+        }
+        if (crossoverPerFrame < 0 && optimizedAvg[step] + setupAvg < referenceAvg[step]) {
+            crossoverPerFrame = count;
+        }
+    }
+
+    y += 4;
+    std::snprintf(line, sizeof(line), "%s: %lu us", info.setupLabel, setupAvg);
+    renderer.drawText(line, 20, y, Color::Yellow, 1);
+    y += 10;
+
+    if (crossoverAmortized > 0) {
+        std::snprintf(line, sizeof(line), "WINS FROM N=%d (SETUP ONCE)", crossoverAmortized);
+    } else {
+        std::snprintf(line, sizeof(line), "NO WIN (SETUP ONCE)");
+    }
+    renderer.drawText(line, 20, y, Color::Green, 1);
+    y += 10;
+
+    if (crossoverPerFrame > 0) {
+        std::snprintf(line, sizeof(line), "WINS FROM N=%d (PER FRAME)", crossoverPerFrame);
+    } else {
+        std::snprintf(line, sizeof(line), "NO WIN (PER FRAME)");
+    }
+    renderer.drawText(line, 20, y, Color::Green, 1);
+    y += 10;
+
+    if (page == Page::MULTISPRITE_FLATTEN) {
+        if (flattenMismatches == 0) {
+            std::snprintf(line, sizeof(line), "VALIDATE: PIXEL-IDENTICAL");
+        } else {
+            std::snprintf(line, sizeof(line), "VALIDATE: %d PX DIFFER", flattenMismatches);
+        }
+        renderer.drawText(line, 20, y, flattenMismatches == 0 ? Color::Green : Color::Red, 1);
+    }
+}
+
+void RenderBenchmarkScene::draw(pr32::graphics::Renderer& renderer) {
+    if (!work) return;  // Left for the menu this frame
+
+    renderer.drawFilledRectangle(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT, Color::Black);
+
+    switch (page) {
+        case Page::SPRITE_BATCH:
+            runSpriteBatchBench(renderer);
+            break;
+        case Page::MULTISPRITE_FLATTEN:
+            runFlattenBench(renderer);
+            break;
+        case Page::SPRITE_RLE:
+            runRLEBench(renderer);
+            break;
+        case Page::ROW_UNPACK:
+            runUnpackBench();
+            break;
+        case Page::PIXEL_KERNELS:
+            runKernelBench();
+            break;
+        case Page::PALETTE_LUT:
+            runPaletteBench();
+            break;
+        case Page::INDEXED_FRAMEBUFFER:
+            runFramebufferBench();
+            break;
+        case Page::STATIC_LAYER:
+            runStaticLayerBench(renderer);
+            break;
+        case Page::TEXT_CACHE:
+            runTextCacheBench(renderer);
+            break;
+        default:
+            break;
+    }
+
+    if (++samples >= SamplesPerReport) {
+        for (int i = 0; i < MaxRows; ++i) {
+            referenceAvg[i] = referenceTotal[i] / samples;
+            optimizedAvg[i] = optimizedTotal[i] / samples;
+        }
+        setupAvg = setupRuns ? setupTotal / setupRuns : 0;
+        hasReport = true;
+        resetTotals();
+    }
+
+    // The workload stays in the top band; the report goes below the separator.
+    renderer.drawLine(0, BENCH_AREA_H, DISPLAY_WIDTH - 1, BENCH_AREA_H, Color::DarkGray);
+    drawReport(renderer);
+
+    Scene::draw(renderer);
+}
+
+}
@@ -0,0 +1,139 @@
+#pragma once
+#include "core/Scene.h"
+#include "graphics/Renderer.h"
+#include "EngineConfig.h"
+
+namespace renderbenchmark {
+
+/**
+ * @brief Measures renderer fast paths against the regular draw calls.
+ *
+ * Each page draws a fixed workload every frame: first with the reference
+ * draw call, then with the optimized path, for 1 to 64 instances. The scene
+ * adds up the elapsed microseconds and, every SamplesPerReport frames,
+ * prints the averages and the crossover point. LEFT/RIGHT switch pages and B
+ * returns to the menu. The workload drawn in the top band is throwaway; only
+ * the numbers matter. Its buffers are allocated in init() and freed on the
+ * way back to the menu, so they take no memory while the scene is unused.
+ *
+ * Pages:
+ * - Sprite batch: scaled drawSprite(..., 1.25, 1.25, ...) vs SpriteBatch.
+ *   Setup is the one-time prepare (scaling) cost.
+ * - MultiSprite flatten: two-layer drawMultiSprite vs the flattened 2bpp
+ *   FlatSprite. Setup is the flatten cost; the page also shows the
+ *   pixel-validation result.
+ * - Sprite RLE: sparse 16x16 1bpp ring via drawSprite vs its span-encoded
+ *   SpriteRLE. Setup is the encode cost.
+ * - Row unpack: per-pixel shift/mask decoding vs the table-driven
+ *   common::unpackRow, for every bpp with and without flip and clip. Rows
+ *   are cases rather than instance counts, and both outputs are compared.
+ * - Pixel kernels: scalar vs the SIMD RGB565 fill, copy, masked copy and 2x
+ *   upscale selected by common::pixelKernels(), per 240x240 of output.
+ * - Palette LUT: indexed pixels resolved one at a time (dual-palette mode,
+ *   layer and byte order checked per pixel) vs common::blitIndexed through
+ *   the flat tables of a common::PaletteLUT, per 240x240 of output. The page
+ *   also shows what rebuilding the tables on a palette switch costs.
+ * - Indexed framebuffer: one frame (clear, filled rectangles, keyed sprite
+ *   rows, present) drawn into an RGB565 band, resolving colors as it draws,
+ *   vs a common::IndexedFramebuffer band of palette indices converted at
+ *   present. Setup is a palette flash: a table rebuild for the indexed
+ *   frame, where the RGB565 frame has to be drawn again.
+ * - Static layer: the Space Invaders starfield, the Pong court and the
+ *   DualPaletteTest swatches painted straight into the renderer vs replayed
+ *   from a common::StaticLayer, full screen. Setup is the recording cost;
+ *   the page also shows how many Renderer calls each path makes.
+ * - Text cache: the games' HUD strings drawn with drawText vs a warm
+ *   common::TextCache. Setup is the first draw of every string (a miss
+ *   and rasterization each); the page also shows the fill calls (runs)
+ *   each cached string replays as.
+ */
+class RenderBenchmarkScene : public pixelroot32::core::Scene {
+public:
+    RenderBenchmarkScene();
+    ~RenderBenchmarkScene();
+    void init() override;
+    void update(unsigned long deltaTime) override;
+    void draw(pixelroot32::graphics::Renderer& renderer) override;
+
+private:
+    enum class Page {
+        SPRITE_BATCH,
+        MULTISPRITE_FLATTEN,
+        SPRITE_RLE,
+        ROW_UNPACK,
+        PIXEL_KERNELS,
+        PALETTE_LUT,
+        INDEXED_FRAMEBUFFER,
+        STATIC_LAYER,
+        TEXT_CACHE,
+        COUNT
+    };
+
+    static constexpr int InstanceSteps = 7;      // 1, 2, 4 ... 64 instances
+    static constexpr int UnpackCases = 12;       // 3 bpp x flip x clip
+    static constexpr int KernelCases = 4;        // fill, copy, masked copy, upscale
+    static constexpr int PaletteCases = 4;       // layer x byte order
+    static constexpr int FramebufferCases = 4;   // clear, rects, sprite rows, present
+    static constexpr int StaticCases = 3;        // starfield, Pong court, swatches
+    static constexpr int TextCases = 6;          // HUD strings at size 1 and 2
+    static constexpr int MaxRows = UnpackCases;
+    static constexpr int SamplesPerReport = 30;  // Frames averaged per report
+
+    void selectPage(Page next);
+    void resetTotals();
+
+    // Workloads: accumulate reference/optimized/setup time for the current frame.
+    void runSpriteBatchBench(pixelroot32::graphics::Renderer& renderer);
+    void runFlattenBench(pixelroot32::graphics::Renderer& renderer);
+    void runRLEBench(pixelroot32::graphics::Renderer& renderer);
+    void runUnpackBench();
+    void runKernelBench();
+    void runPaletteBench();
+    void runFramebufferBench();
+    void runStaticLayerBench(pixelroot32::graphics::Renderer& renderer);
+    void runTextCacheBench(pixelroot32::graphics::Renderer& renderer);
+
+    void drawReport(pixelroot32::graphics::Renderer& renderer);
+    // Report for pages whose rows are named cases instead of instance counts.
+    void drawCaseReport(pixelroot32::graphics::Renderer& renderer, int y);
+    const char* caseLabel(int index) const;
+    int caseCount() const;
+    int caseMismatches() const;
+
+    Page page;
+
+    unsigned long referenceTotal[MaxRows];
+    unsigned long optimizedTotal[MaxRows];
+    unsigned long setupTotal;
+    unsigned long setupRuns;
+    int samples;
+
+    // Last published averages (microseconds per frame).
+    unsigned long referenceAvg[MaxRows];
+    unsigned long optimizedAvg[MaxRows];
+    unsigned long setupAvg;
+    bool hasReport;
+
+    // Pixel mismatches between the flattened and layered sprite (-1 = not built).
+    int flattenMismatches;
+
+    // Pixels where the table-driven unpacker disagrees with the per-pixel one.
+    int unpackMismatches;
+
+    // Pixels where the selected SIMD kernels disagree with the scalar ones.
+    int kernelMismatches;
+
+    // Pixels where the palette tables disagree with per-pixel resolution.
+    int paletteMismatches;
+
+    // Pixels where the presented indexed frame differs from the RGB565 one.
+    int framebufferMismatches;
+
+    // Pixels where a replayed background differs from the directly painted one.
+    int staticMismatches;
+
+    // Pixels where a cached string differs from its glyph bits.
+    int textMismatches;
+};
+
+}
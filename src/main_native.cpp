@@ -12,6 +12,9 @@
 
 namespace pr32 = pixelroot32;
 
+// Second argument is the SDL device buffer in samples. It is fixed here: the
+// AUDIO LATENCY page of the Audio Lab sweeps the AudioTask's ring buffer
+// target (setBufferTarget()), not this buffer.
 pr32::drivers::native::SDL2_AudioBackend audioBackend(22050, 1024);
 
 pr32::graphics::DisplayConfig config(